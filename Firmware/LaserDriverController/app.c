@@ -1,6 +1,7 @@
 #include "hwbp_core.h"
 #include "hwbp_core_regs.h"
 #include "hwbp_core_types.h"
+#include "hwbp_core_com.h"
 
 #include "app.h"
 #include "app_funcs.h"
@@ -16,11 +17,9 @@ extern AppRegs app_regs;
 extern uint8_t app_regs_type[];
 extern uint16_t app_regs_n_elements[];
 extern uint8_t *app_regs_pointer[];
-extern void (*app_func_rd_pointer[])(void);
-extern bool (*app_func_wr_pointer[])(void*);
+extern void (* const app_func_rd_pointer[])(void) PROGMEM;
+extern bool (* const app_func_wr_pointer[])(void*) PROGMEM;
 extern ports_state_t state_on_or_off;
-countdown_t pulse_countdown;
-interval_t s_bnc_0, s_bnc_1, s_signal_a, s_signal_b;
 
 #define _1_CLOCK_CYCLES asm ( "nop \n")
 #define _2_CLOCK_CYCLES _1_CLOCK_CYCLES; _1_CLOCK_CYCLES
@@ -33,6 +32,12 @@ interval_t s_bnc_0, s_bnc_1, s_signal_a, s_signal_b;
 /************************************************************************/
 static const uint8_t default_device_name[] = "LaserDriverController";
 
+/* core_save_all_registers_to_eeprom() writes the register bank from    */
+/* EEPROM byte 32 on, so 2016 of the 2048 bytes are left for it. The    */
+/* bank takes 1333 bytes, 256 of them for the intensity LUT.            */
+#define APP_EEPROM_OFFSET 32
+_Static_assert(APP_NBYTES_OF_REG_BANK <= EEPROM_SIZE - APP_EEPROM_OFFSET, "The register bank doesn't fit in the EEPROM");
+
 void hwbp_app_initialize(void)
 {
     /* Define versions */
@@ -59,117 +64,1531 @@ void hwbp_app_initialize(void)
 }
 
 /************************************************************************/
-/* Handle if a catastrophic error occur                                 */
+/* Handle if a catastrophic error occur                                 */
+/************************************************************************/
+void core_callback_catastrophic_error_detected(void)
+{
+	
+}
+
+/************************************************************************/
+/* User functions                                                       */
+/************************************************************************/
+/* Add your functions here or load external functions if needed */
+
+/* The digipot latches a 10-bit word (address 01 + 8 data bits) on the rising edge of CS */
+/* Each word goes out as two SPID bytes, {0x01, data}, the digipot keeps the last 10 bits */
+/* The SPID interrupt sends the second byte and releases CS, so writes never wait on the SPI */
+/* Only one value waits for the SPI, a newer write replaces it so stale values are never sent */
+static volatile uint8_t digipot_pending;
+static volatile bool digipot_has_pending = false;
+static volatile uint8_t digipot_data;			// data byte of the word being sent
+static volatile uint8_t digipot_state = 0;	// bytes of the current word already sent, 0 -> idle
+
+static void digipot_send_next(void)
+{
+	if (!digipot_has_pending)
+	{
+		digipot_state = 0;
+		return;
+	}
+
+	digipot_data = digipot_pending;
+	digipot_has_pending = false;
+
+	clr_POT_CS;
+	digipot_state = 1;
+	SPID.DATA = 0x01;
+}
+
+void digipot_init(void)
+{
+	digipot_has_pending = false;
+	digipot_state = 0;
+	set_POT_CS;
+	SPID.INTCTRL = SPI_INTLVL_LO_gc;
+}
+
+/* Posts a new wiper value, replacing the one still waiting if any */
+void digipot_write(uint8_t data)
+{
+	uint16_t diag_start = diag_now();
+	uint8_t sreg = SREG;
+
+	cli();
+
+	digipot_pending = data;
+	digipot_has_pending = true;
+
+	if (digipot_state == 0)
+		digipot_send_next();
+
+	SREG = sreg;
+	diag_end(DIAG_DIGIPOT, diag_start);
+}
+
+/* Called from the SPID interrupt when a byte is out */
+void digipot_spi_done(void)
+{
+	if (digipot_state == 1)
+	{
+		digipot_state = 2;
+		SPID.DATA = digipot_data;
+		return;
+	}
+
+	set_POT_CS;		// latches the word
+	latency_effect(LATENCY_DIGIPOT);
+	digipot_send_next();
+}
+
+//Update and send event of digital SPAD_SWITCH register
+void spad_switch_events(uint8_t state){
+	uint8_t reg_spad_switch = app_regs.REG_SPAD_SWITCH;
+	if(state==1){
+		if(app_regs.REG_EVNT_ENABLE &  B_EVT_SPAD_SWITCH ){
+			app_regs.REG_SPAD_SWITCH = 1;
+			set_MCU_TO_RELAY;
+			if(reg_spad_switch != app_regs.REG_SPAD_SWITCH){
+				app_send_event(ADD_REG_SPAD_SWITCH, true);
+			}		 
+		}
+	}
+	else{
+		if(app_regs.REG_EVNT_ENABLE & B_EVT_SPAD_SWITCH ){
+			app_regs.REG_SPAD_SWITCH = 0;
+			clr_MCU_TO_RELAY;
+			if(reg_spad_switch != app_regs.REG_SPAD_SWITCH){
+				app_send_event(ADD_REG_SPAD_SWITCH, true);
+			}		
+		}
+	}
+}
+
+
+void set_laser_freq(uint8_t value){
+	if(value == 0){
+		clr_F1;
+		clr_F2;
+		clr_F3;
+		app_regs.REG_LASER_FREQUENCY_SELECT = 0;
+	}
+	if(value & B_F1){
+		set_F1;
+		clr_F2;
+		clr_F3;
+		app_regs.REG_LASER_FREQUENCY_SELECT = B_F1;
+	}
+	if(value & B_F2){
+		clr_F1;
+		set_F2;
+		clr_F3;
+		app_regs.REG_LASER_FREQUENCY_SELECT = B_F2;
+	}
+	if(value & B_F3){
+		clr_F1;
+		clr_F2;
+		set_F3;
+		app_regs.REG_LASER_FREQUENCY_SELECT = B_F3;
+	}
+	if(value & B_CW){
+		set_F1;
+		set_F2;
+		set_F3;
+		app_regs.REG_LASER_FREQUENCY_SELECT = B_CW;
+	}
+
+}
+
+
+/************************************************************************/
+/* Pulse engine                                                         */
+/************************************************************************/
+/* TCD0 runs free at 32 MHz / 8 and TCD1 counts its overflows through   */
+/* event channel 7, giving a 32-bit timebase. Every running channel     */
+/* keeps the absolute time of its next edge and a single compare is     */
+/* armed for the earliest one, so the engine only wakes when an edge or */
+/* the end of a train is due.                                           */
+/* The compare on TCD1 waits for the high word of a far edge, the one   */
+/* on TCD0 then matches its low word.                                   */
+channel_t channels[PULSE_CHANNELS] = {
+	{ .pin_mask = (1<<0), .state_mask = B_BNC0, .sequence = app_regs.REG_BNC0_SEQUENCE,
+	  .timing_us = &app_regs.REG_BNC0_ON_US, .pulses = &app_regs.REG_BNC0_PULSES },
+	{ .pin_mask = (1<<2), .state_mask = B_BNC1, .sequence = app_regs.REG_BNC1_SEQUENCE,
+	  .timing_us = &app_regs.REG_BNC1_ON_US, .pulses = &app_regs.REG_BNC1_PULSES },
+	{ .pin_mask = (1<<4), .state_mask = B_SIGNAL_A, .sequence = app_regs.REG_SIGNAL_A_SEQUENCE,
+	  .timing_us = &app_regs.REG_SIGNAL_A_ON_US, .pulses = &app_regs.REG_SIGNAL_A_PULSES },
+	{ .pin_mask = (1<<7), .state_mask = B_SIGNAL_B, .sequence = app_regs.REG_SIGNAL_B_SEQUENCE,
+	  .timing_us = &app_regs.REG_SIGNAL_B_ON_US, .pulses = &app_regs.REG_SIGNAL_B_PULSES },
+};
+
+/* One bit per channel of the table, set while its train is running */
+volatile uint8_t pulse_running = 0;
+
+/* PORTJ outputs whose latched timings go high as soon as they start */
+uint8_t pulse_first_high_pins = 0;
+
+/* One bit per channel of the table, set while its output is high */
+static uint8_t pulse_levels = 0;
+
+/* Channel whose falling edges step the intensity sequence */
+static uint8_t intensity_channel = INTENSITY_CHANNEL_NONE;
+
+/* Converts a PulseChannels mask into PORTJ pins */
+uint8_t channels_to_pins(uint8_t mask)
+{
+	uint8_t pins = 0;
+
+	for (uint8_t ch = 0; ch < PULSE_CHANNELS; ch++)
+		if (mask & (1 << ch))
+			pins |= channels[ch].pin_mask;
+
+	return pins;
+}
+
+/* The BNCs report in BncsState and the Signals in SignalState */
+static void channel_state_clear(uint8_t ch)
+{
+	if ((1 << ch) & (B_CH_BNC1 | B_CH_BNC2))
+		app_regs.REG_BNCS_STATE &= ~channels[ch].state_mask;
+	else
+		app_regs.REG_SIGNAL_STATE &= ~channels[ch].state_mask;
+}
+
+void pulse_timer_init(void)
+{
+	pulse_running = 0;
+
+	TCD0.CTRLA = TC_CLKSEL_OFF_gc;
+	TCD1.CTRLA = TC_CLKSEL_OFF_gc;
+
+	TCD0.CTRLB = TC_WGMODE_NORMAL_gc;
+	TCD0.INTCTRLA = 0;
+	TCD0.INTCTRLB = 0;
+	TCD0.PER = 0xFFFF;
+	TCD0.CNT = 0;
+	TCD0.INTFLAGS = TC0_CCAIF_bm;
+
+	TCD1.CTRLB = TC_WGMODE_NORMAL_gc;
+	TCD1.INTCTRLA = 0;
+	TCD1.INTCTRLB = 0;
+	TCD1.PER = 0xFFFF;
+	TCD1.CNT = 0;
+	TCD1.INTFLAGS = TC1_CCAIF_bm;
+
+	EVSYS.CH7MUX = EVSYS_CHMUX_TCD0_OVF_gc;
+	TCD1.CTRLA = TC_CLKSEL_EVCH7_gc;
+	TCD0.CTRLA = TC_CLKSEL_DIV8_gc;
+}
+
+/* Interrupts are held during the reads, since the 16-bit TEMP register */
+/* of the timers is shared with the interrupts that also read them.     */
+uint32_t pulse_time_now(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t hi, lo;
+
+	cli();
+
+	do {
+		hi = TCD1.CNT;
+		lo = TCD0.CNT;
+	} while (hi != TCD1.CNT);
+
+	SREG = sreg;
+	return ((uint32_t)hi << 16) | lo;
+}
+
+/* Keeps the output level of a channel and reports the edge when it     */
+/* actually changes. Returns true on a real toggle.                     */
+static bool pulse_level_set(uint8_t ch, bool high, uint32_t ticks)
+{
+	uint8_t bit = (1 << ch);
+
+	if (high == ((pulse_levels & bit) != 0))
+		return false;
+
+	pulse_levels ^= bit;
+
+	if (app_regs.REG_EDGE_EVENTS_CHANNELS & bit)
+		edge_event_push(ch, high, ticks);
+
+	return true;
+}
+
+#define seq_duration(c, i)	((c)->sequence[i] & SEQ_DURATION_MASK)
+#define seq_phase(c, i)		(((c)->sequence[i] & SEQ_LEVEL_bm) ? PHASE_ON : PHASE_OFF)
+
+/* Moves a sequence to its next segment. The segments are read from the */
+/* register, so a new upload takes effect on the next segment.          */
+static bool pulse_sequence_next(channel_t *c)
+{
+	countdown_t *t = &c->t;
+
+	if (t->phase == PHASE_END)
+		return false;
+
+	t->deadline += seq_duration(c, t->seq_index) * PULSE_TICKS_PER_US;
+
+	if (++t->seq_index == SEQ_LENGTH || seq_duration(c, t->seq_index) == 0)
+	{
+		t->seq_index = 0;
+
+		if (t->count_pulses == 1 || seq_duration(c, 0) == 0)
+		{
+			t->phase = PHASE_END;
+			return true;
+		}
+		if (t->count_pulses) t->count_pulses--;
+	}
+
+	t->phase = seq_phase(c, t->seq_index);
+	return true;
+}
+
+/* Moves the train to its next edge, counting from the edge just        */
+/* produced so the train does not drift.                                */
+/* Returns false when the train is over.                                */
+static bool pulse_train_next(channel_t *c)
+{
+	interval_t *s = &c->cfg;
+	countdown_t *t = &c->t;
+	bool last_pulse = (t->count_pulses == 1);
+
+	if (c->play_sequence)
+		return pulse_sequence_next(c);
+
+	switch (t->phase)
+	{
+		case PHASE_ON:
+			/* A pulse starts, new times written while running apply from here */
+			if (c->reload)
+			{
+				s->on_us = c->next_on_us;
+				s->off_us = c->next_off_us;
+				c->reload = false;
+			}
+
+			if (s->off_us)
+			{
+				t->phase = PHASE_OFF;
+			}
+			else if (last_pulse)
+			{
+				t->phase = PHASE_END;
+			}
+			else
+			{
+				if (t->count_pulses) t->count_pulses--;
+			}
+			t->deadline += s->on_us * PULSE_TICKS_PER_US;
+			return true;
+
+		case PHASE_OFF:
+			if (last_pulse)
+			{
+				t->phase = PHASE_END;
+			}
+			else
+			{
+				if (t->count_pulses) t->count_pulses--;
+				t->phase = PHASE_ON;
+			}
+			t->deadline += s->off_us * PULSE_TICKS_PER_US;
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+/* Arms the compare for 'deadline'. Flags are cleared before the        */
+/* compare is written, so a match right after the write is kept.        */
+static void pulse_arm(uint32_t deadline)
+{
+	uint16_t high = (uint16_t)(deadline >> 16);
+
+	if (high != TCD1.CNT)
+	{
+		TCD0.INTCTRLB = TC_CCAINTLVL_OFF_gc;
+		TCD1.INTFLAGS = TC1_CCAIF_bm;
+		TCD1.CCA = high;
+		TCD1.INTCTRLB = TC_CCAINTLVL_HI_gc;
+
+		/* Reached while arming, the compare would wait for TCD1 to wrap */
+		if (high != TCD1.CNT)
+			return;
+	}
+
+	TCD1.INTCTRLB = TC_CCAINTLVL_OFF_gc;
+	TCD0.INTFLAGS = TC0_CCAIF_bm;
+	TCD0.CCA = (uint16_t)deadline;
+	TCD0.INTCTRLB = TC_CCAINTLVL_HI_gc;
+}
+
+/* Produces every edge that is due and arms the compare for the next    */
+/* one. Runs from the compare interrupts and after a channel starts.    */
+void pulse_schedule(void)
+{
+	for (;;)
+	{
+		uint32_t now = pulse_time_now();
+		uint32_t next = 0;
+		bool pending = false;
+		uint8_t set_j = 0, clr_j = 0;
+		bool step_intensity = false;
+		uint8_t ch, running;
+
+		for (ch = 0, running = pulse_running; running; ch++, running >>= 1)
+		{
+			if (!(running & 1))
+				continue;
+
+			channel_t *c = &channels[ch];
+
+			if ((int32_t)(c->t.deadline - now) <= 0)
+			{
+				bool rising = (c->t.phase == PHASE_ON);
+				bool toggled = pulse_level_set(ch, rising, c->t.deadline);
+
+				if (rising) set_j |= c->pin_mask;
+				else clr_j |= c->pin_mask;
+
+				if (!pulse_train_next(c))
+				{
+					pulse_running &= ~(1 << ch);
+					channel_state_clear(ch);
+					state_change_push(1 << ch, c->t.deadline);
+					if (ch == intensity_channel)
+						intensity_sequence_stop();
+					continue;
+				}
+
+				/* Only a real high to low change moves to the next value */
+				if (toggled && !rising && ch == intensity_channel)
+					step_intensity = true;
+			}
+
+			if (!pending || (int32_t)(c->t.deadline - next) < 0)
+				next = c->t.deadline;
+			pending = true;
+		}
+
+		/* Edges due at the same time change together */
+		PORTJ.OUTSET = set_j;
+		PORTJ.OUTCLR = clr_j;
+
+		if (step_intensity)
+			intensity_sequence_step();
+
+		if (!pending)
+		{
+			TCD0.INTCTRLB = TC_CCAINTLVL_OFF_gc;
+			TCD1.INTCTRLB = TC_CCAINTLVL_OFF_gc;
+			return;
+		}
+
+		/* Too close to be caught by the compare, produce it right away */
+		if ((int32_t)(next - now) < PULSE_MIN_LEAD_TICKS)
+			continue;
+
+		pulse_arm(next);
+
+		/* The timebase must not have passed the compare while arming */
+		if ((int32_t)(next - pulse_time_now()) > 0)
+			return;
+	}
+}
+
+/* Starts the trains of the channels in 'mask' from the same timer      */
+/* tick t0, so their relative phase is exact. t0 may be in the near     */
+/* future. Each channel plays its cfg, or its sequence if play_sequence */
+/* is set (cfg.pulses then counts the loops).                           */
+/* Interrupts are held while the running channels change, since the     */
+/* trigger input can start channels from its own interrupt.             */
+void pulse_channels_start_at(uint8_t mask, uint32_t t0)
+{
+	uint8_t sreg = SREG;
+	uint32_t now;
+
+	cli();
+	now = pulse_time_now();
+
+	for (uint8_t ch = 0; ch < PULSE_CHANNELS; ch++)
+	{
+		channel_t *c = &channels[ch];
+		bool can_start;
+
+		if (!(mask & (1 << ch)))
+			continue;
+
+		pulse_running &= ~(1 << ch);
+
+		if (c->play_sequence)
+		{
+			c->t.seq_index = 0;
+			c->t.phase = seq_phase(c, 0);
+			can_start = (seq_duration(c, 0) != 0);
+		}
+		else
+		{
+			c->t.phase = PHASE_ON;
+			can_start = (c->cfg.on_us != 0);
+		}
+
+		c->t.count_pulses = c->cfg.pulses;
+		c->t.deadline = t0 + c->cfg.tail_us * PULSE_TICKS_PER_US;
+		c->reload = false;
+
+		/* An output that goes high right away is not pulled low first */
+		if (!can_start || c->t.phase != PHASE_ON || (int32_t)(c->t.deadline - now) > 0)
+		{
+			PORTJ.OUTCLR = c->pin_mask;
+			pulse_level_set(ch, false, now);
+		}
+
+		if (can_start)
+			pulse_running |= (1 << ch);
+	}
+
+	intensity_sequence_start(mask);
+	state_change_push(mask & pulse_running, t0);
+	pulse_schedule();
+	SREG = sreg;
+}
+
+void pulse_channels_start(uint8_t mask)
+{
+	pulse_channels_start_at(mask, pulse_time_now());
+}
+
+void pulse_channels_stop(uint8_t mask)
+{
+	uint8_t sreg = SREG;
+	uint8_t stopped;
+	uint32_t now;
+
+	cli();
+	now = pulse_time_now();
+	stopped = mask & pulse_running;
+
+	for (uint8_t ch = 0; ch < PULSE_CHANNELS; ch++)
+	{
+		if (mask & (1 << ch))
+		{
+			pulse_running &= ~(1 << ch);
+			PORTJ.OUTCLR = channels[ch].pin_mask;
+			pulse_level_set(ch, false, now);
+
+			channel_state_clear(ch);
+
+			if (ch == intensity_channel)
+				intensity_sequence_stop();
+		}
+	}
+
+	/* A train cut short is reported like one that ends by itself */
+	state_change_push(stopped, now);
+	pulse_schedule();
+	SREG = sreg;
+}
+
+/************************************************************************/
+/* Pattern output                                                       */
+/************************************************************************/
+/* DMA channel 0 copies one byte per slot into PORTJ.OUTTGL, paced by   */
+/* the TCC0 overflow. Each byte toggles only the channel pins that      */
+/* change from the previous slot, so the other PORTJ pins (e.g. the     */
+/* UART CTS) are never touched and all channels switch on the same      */
+/* clock edge without CPU.                                              */
+/* Slot 0 is set when the pattern starts and every transfer moves to    */
+/* the next slot, the last one wrapping back to slot 0. The transfer    */
+/* that ends the last loop completes the DMA, whose interrupt stops the */
+/* pattern right away.                                                  */
+static uint8_t pattern_dma[PATTERN_MAX_LENGTH];
+
+bool pattern_start(void)
+{
+	uint8_t length = app_regs.REG_PATTERN_LENGTH;
+	uint8_t all_pins = channels_to_pins(B_CH_ALL);
+	uint8_t first, last;
+
+	if (length == 0 || !read_ON_OFF_KEY)
+		return false;
+
+	pattern_stop();
+
+	/* The pattern owns the outputs while it plays */
+	pulse_channels_stop(B_CH_ALL);
+	app_regs.REG_BNCS_STATE = 0;
+	app_regs.REG_SIGNAL_STATE = 0;
+
+	first = channels_to_pins(app_regs.REG_PATTERN[0]);
+	last = first;
+
+	for (uint8_t i = 1; i < length; i++)
+	{
+		uint8_t pins = channels_to_pins(app_regs.REG_PATTERN[i]);
+		pattern_dma[i - 1] = pins ^ last;
+		last = pins;
+	}
+	pattern_dma[length - 1] = first ^ last;
+
+	TCC0.CTRLA = TC_CLKSEL_OFF_gc;
+	TCC0.CTRLB = TC_WGMODE_NORMAL_gc;
+	TCC0.INTCTRLA = 0;
+	TCC0.INTCTRLB = 0;
+	TCC0.CNT = 0;
+	TCC0.PER = app_regs.REG_PATTERN_SLOT * 32 - 1;
+
+	DMA.CTRL = DMA_ENABLE_bm;
+	DMA.CH0.CTRLA = 0;
+	DMA.CH0.ADDRCTRL = DMA_CH_SRCRELOAD_BLOCK_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc;
+	DMA.CH0.TRIGSRC = DMA_CH_TRIGSRC_TCC0_OVF_gc;
+	DMA.CH0.TRFCNT = length;
+	DMA.CH0.REPCNT = app_regs.REG_PATTERN_LOOPS;
+	DMA.CH0.SRCADDR0 = (uint8_t)((uint16_t)pattern_dma);
+	DMA.CH0.SRCADDR1 = (uint8_t)((uint16_t)pattern_dma >> 8);
+	DMA.CH0.SRCADDR2 = 0;
+	DMA.CH0.DESTADDR0 = (uint8_t)((uint16_t)&PORTJ.OUTTGL);
+	DMA.CH0.DESTADDR1 = (uint8_t)((uint16_t)&PORTJ.OUTTGL >> 8);
+	DMA.CH0.DESTADDR2 = 0;
+	DMA.CH0.CTRLB = DMA_CH_TRNIF_bm | DMA_CH_ERRIF_bm | DMA_CH_TRNINTLVL_HI_gc;
+	DMA.CH0.CTRLA = DMA_CH_ENABLE_bm | DMA_CH_REPEAT_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+
+	app_regs.REG_PATTERN_STATE = 1;
+
+	/* Slot 0 starts with the timer */
+	PORTJ.OUTCLR = all_pins & ~first;
+	PORTJ.OUTSET = first;
+	TCC0.CTRLA = TC_CLKSEL_DIV1_gc;
+
+	return true;
+}
+
+void pattern_stop(void)
+{
+	TCC0.CTRLA = TC_CLKSEL_OFF_gc;
+	TCC0.INTCTRLA = 0;
+	DMA.CH0.CTRLB = DMA_CH_TRNIF_bm | DMA_CH_ERRIF_bm;
+	DMA.CH0.CTRLA = 0;
+
+	if (app_regs.REG_PATTERN_STATE)
+		PORTJ.OUTCLR = channels_to_pins(B_CH_ALL);
+
+	app_regs.REG_PATTERN_STATE = 0;
+}
+
+
+/************************************************************************/
+/* Trigger input                                                        */
+/************************************************************************/
+/* When enabled, DO2 becomes an input whose high-level interrupt starts */
+/* the trigger channels. Outputs that go high at the trigger are set    */
+/* first thing in the interrupt, the channels are then loaded from      */
+/* their bank and start from the time of the trigger.                   */
+uint8_t trigger_pins = 0;
+
+void trigger_config(void)
+{
+	uint8_t mode = app_regs.REG_TRIGGER_MODE;
+
+	io_set_int(&PORTC, INT_LEVEL_OFF, 0, (1<<2), true);
+
+	if (mode == GM_TRIGGER_DISABLED)
+	{
+		io_pin2out(&PORTC, 2, OUT_IO_DIGITAL, IN_EN_IO_EN);                  // DO2
+		if (app_regs.REG_OUTPUT_STATE & B_DOUT2) set_DO2; else clr_DO2;
+		return;
+	}
+
+	update_first_high_pins(app_regs.REG_TRIGGER_CHANNELS);
+	trigger_pins = channels_to_pins(app_regs.REG_TRIGGER_CHANNELS);
+
+	if (mode == GM_TRIGGER_RISING)
+		io_pin2in(&PORTC, 2, PULL_IO_DOWN, SENSE_IO_EDGE_RISING);
+	else if (mode == GM_TRIGGER_FALLING)
+		io_pin2in(&PORTC, 2, PULL_IO_DOWN, SENSE_IO_EDGE_FALLING);
+	else
+		io_pin2in(&PORTC, 2, PULL_IO_DOWN, SENSE_IO_EDGES_BOTH);
+
+	PORTC.INTFLAGS = PORT_INT0IF_bm;
+	io_set_int(&PORTC, INT_LEVEL_HIGH, 0, (1<<2), true);
+}
+
+/* Called from the trigger interrupt */
+void trigger_fire(void)
+{
+	uint32_t t0 = pulse_time_now();
+	uint8_t mask = app_regs.REG_TRIGGER_CHANNELS;
+
+	if (app_regs.REG_PATTERN_STATE)
+		pattern_stop();
+
+	/* Same bit order as the BNCs and Signals start registers */
+	app_regs.REG_BNCS_STATE |= mask & (B_BNC0 | B_BNC1);
+	app_regs.REG_SIGNAL_STATE |= (mask >> 2) & (B_SIGNAL_A | B_SIGNAL_B);
+
+	load_channels(mask);
+	pulse_channels_start_at(mask, t0);
+}
+
+
+/************************************************************************/
+/* Scheduled start                                                      */
+/************************************************************************/
+/* The engine time at every new Harp second is kept, so a Harp start    */
+/* time can be converted into an engine deadline with the same offset   */
+/* to the second boundary on every device sharing the clock. The start  */
+/* is handed to the engine once it falls in the current or the next     */
+/* Harp second, up to two seconds ahead, so a start early in a second   */
+/* is armed before that second begins.                                  */
+/* The core's TCC1 overflows at every new second. The overflow is       */
+/* routed through event channel 6 to a capture on TCD0 CCC, so the mark */
+/* is the engine time of the boundary itself and not of the callback.   */
+static uint32_t second_mark;
+static uint32_t second_mark_ticks;
+static bool second_mark_valid = false;
+
+void scheduled_start_init(void)
+{
+	EVSYS.CH6MUX = EVSYS_CHMUX_TCC1_OVF_gc;
+	TCD0.CTRLB |= TC0_CCCEN_bm;		// capture selected in interlock_init()
+}
+
+void scheduled_start_new_second(void)
+{
+	uint32_t now = pulse_time_now();
+	uint16_t edge;
+
+	if (TCD0.INTFLAGS & TC0_CCCIF_bm)
+	{
+		/* Reading CCC pulls the next capture from its buffer, the last one is this second */
+		do {
+			edge = TCD0.CCC;
+		} while (TCD0.INTFLAGS & TC0_CCCIF_bm);
+
+		second_mark_ticks = now - (uint16_t)((uint16_t)now - edge);
+	}
+	else
+	{
+		/* The second was started by a clock update, not by the overflow */
+		second_mark_ticks = now;
+	}
+
+	second_mark = core_func_read_R_TIMESTAMP_SECOND();
+	second_mark_valid = true;
+}
+
+bool scheduled_start_arm(uint8_t mask)
+{
+	uint32_t seconds = core_func_read_R_TIMESTAMP_SECOND();
+	uint32_t useconds = (uint32_t)core_func_read_R_TIMESTAMP_MICRO() * 32;
+
+	if (mask)
+	{
+		/* Must be in the future */
+		if (app_regs.REG_START_TIME[0] < seconds)
+			return false;
+		if (app_regs.REG_START_TIME[0] == seconds && app_regs.REG_START_TIME[1] <= useconds)
+			return false;
+
+		if (!read_ON_OFF_KEY)
+			return false;
+
+		load_channels(mask);
+	}
+
+	app_regs.REG_START_TIME_CHANNELS = mask;
+	return true;
+}
+
+/* Called every millisecond */
+void scheduled_start_poll(void)
+{
+	uint8_t mask = app_regs.REG_START_TIME_CHANNELS;
+	int32_t seconds_ahead;
+	uint32_t t0, now;
+
+	if (mask == 0 || !second_mark_valid)
+		return;
+
+	seconds_ahead = (int32_t)(app_regs.REG_START_TIME[0] - second_mark);
+
+	if (seconds_ahead > 1)
+		return;
+
+	t0 = second_mark_ticks + (seconds_ahead * 1000000UL + app_regs.REG_START_TIME[1]) * PULSE_TICKS_PER_US;
+	now = pulse_time_now();
+
+	/* The start is already past (the Harp time moved forward, the start */
+	/* was written late or this poll ran late), start right away instead */
+	/* of replaying the missed edges as a burst                          */
+	if (seconds_ahead < 0 || (int32_t)(t0 - now) < 0)
+		t0 = now;
+
+	app_regs.REG_START_TIME_CHANNELS = 0;
+
+	if (!read_ON_OFF_KEY)
+		return;
+
+	if (app_regs.REG_PATTERN_STATE)
+		pattern_stop();
+
+	/* Same bit order as the BNCs and Signals start registers */
+	app_regs.REG_BNCS_STATE |= mask & (B_BNC0 | B_BNC1);
+	app_regs.REG_SIGNAL_STATE |= (mask >> 2) & (B_SIGNAL_A | B_SIGNAL_B);
+
+	pulse_channels_start_at(mask, t0);
+}
+
+/************************************************************************/
+/* Intensity sequence                                                   */
+/************************************************************************/
+/* The laser intensity follows a table of values in step with one pulse */
+/* channel. The first value is applied when the channel starts and the  */
+/* next one is sent on each falling edge, so the digipot has settled    */
+/* by the time the next pulse begins.                                   */
+static uint8_t intensity_index;
+
+/* Called with interrupts held when the channels in 'mask' start */
+void intensity_sequence_start(uint8_t mask)
+{
+	uint8_t selected = app_regs.REG_INTENSITY_SEQUENCE_CHANNEL & mask;
+
+	if (!selected)
+		return;
+
+	if (app_regs.REG_INTENSITY_SEQUENCE_LENGTH == 0)
+	{
+		intensity_channel = INTENSITY_CHANNEL_NONE;
+		return;
+	}
+
+	for (intensity_channel = 0; !(selected & 1); intensity_channel++)
+		selected >>= 1;
+
+	intensity_index = 0;
+	intensity_sequence_step();
+}
+
+/* The falling edges of the channel no longer step the intensity */
+void intensity_sequence_stop(void)
+{
+	intensity_channel = INTENSITY_CHANNEL_NONE;
+}
+
+void intensity_sequence_step(void)
+{
+	uint8_t length = app_regs.REG_INTENSITY_SEQUENCE_LENGTH;
+
+	if (length == 0)
+		return;
+
+	if (intensity_index >= length)
+		intensity_index = 0;
+
+	app_regs.REG_LASER_INTENSITY = app_regs.REG_INTENSITY_SEQUENCE[intensity_index++];
+	digipot_write(app_regs.REG_LASER_INTENSITY);
+}
+
+/************************************************************************/
+/* Input edges                                                          */
+/************************************************************************/
+/* The SWITCH_5V and ON_OFF_KEY interrupts push every edge, with the    */
+/* pulse engine time, into a ring that only they write to. The 1 ms     */
+/* callback drains it and sends one event per edge, timestamped with    */
+/* the Harp time of the edge itself.                                    */
+/* With a debounce window, the first edge masks the pin interrupt and   */
+/* starts a compare on TCE0. The pin is sampled when the window closes  */
+/* and a change is pushed with the time of that first edge, so chatter  */
+/* never reaches the interrupt or the event path.                       */
+static input_edge_t input_edges[INPUT_EDGES_SIZE];
+static volatile uint8_t input_edges_head = 0, input_edges_tail = 0;
+
+static uint8_t input_level[2];			// level of the last edge pushed
+static uint32_t input_first_ticks[2];	// time of the edge that opened the window
+
+static PORT_t *input_port(uint8_t input)
+{
+	return (input == INPUT_SWITCH_5V) ? &PORTE : &PORTH;
+}
+
+static uint8_t input_read(uint8_t input)
+{
+	if (input == INPUT_SWITCH_5V)
+		return read_SWITCH_5V ? 1 : 0;
+	else
+		return read_ON_OFF_KEY ? 1 : 0;
+}
+
+void input_debounce_init(void)
+{
+	TCE0.CTRLA = TC_CLKSEL_OFF_gc;
+	TCE0.CTRLB = TC_WGMODE_NORMAL_gc;
+	TCE0.INTCTRLA = 0;
+	TCE0.INTCTRLB = 0;
+	TCE0.PER = 0xFFFF;
+	TCE0.CNT = 0;
+	TCE0.CTRLA = TC_CLKSEL_DIV1024_gc;	// 32 us
+
+	input_level[INPUT_SWITCH_5V] = input_read(INPUT_SWITCH_5V);
+	input_level[INPUT_ON_OFF_KEY] = input_read(INPUT_ON_OFF_KEY);
+}
+
+/* The edge is lost if the ring is full */
+static void input_edge_push(uint8_t input, uint8_t level, uint32_t ticks)
+{
+	uint8_t head = input_edges_head;
+	uint8_t next = (head + 1) & (INPUT_EDGES_SIZE - 1);
+
+	input_level[input] = level;
+
+	if (next == input_edges_tail)
+		return;
+
+	input_edges[head].input = input;
+	input_edges[head].level = level;
+	input_edges[head].ticks = ticks;
+	input_edges_head = next;
+}
+
+/* Called from the input pin interrupts */
+void input_edge_detected(uint8_t input)
+{
+	uint32_t now = pulse_time_now();
+	uint8_t window_ms;
+	uint16_t window_end;
+
+	if (input == INPUT_SWITCH_5V)
+		window_ms = app_regs.REG_SPAD_SWITCH_DEBOUNCE;
+	else
+		window_ms = app_regs.REG_LASER_STATE_DEBOUNCE;
+
+	if (window_ms == 0)
+	{
+		input_edge_push(input, input_read(input), now);
+		return;
+	}
+
+	input_port(input)->INTCTRL &= ~PORT_INT0LVL_gm;
+	input_first_ticks[input] = now;
+
+	window_end = TCE0.CNT + (uint16_t)(((uint32_t)window_ms * 1000) / 32);
+
+	if (input == INPUT_SWITCH_5V)
+	{
+		TCE0.CCB = window_end;
+		TCE0.INTFLAGS = TC0_CCBIF_bm;
+		TCE0.INTCTRLB = (TCE0.INTCTRLB & ~TC0_CCBINTLVL_gm) | TC_CCBINTLVL_LO_gc;
+	}
+	else
+	{
+		TCE0.CCA = window_end;
+		TCE0.INTFLAGS = TC0_CCAIF_bm;
+		TCE0.INTCTRLB = (TCE0.INTCTRLB & ~TC0_CCAINTLVL_gm) | TC_CCAINTLVL_LO_gc;
+	}
+}
+
+/* Called from the TCE0 compare interrupts when a window closes */
+void input_debounce_done(uint8_t input)
+{
+	PORT_t *port = input_port(input);
+	uint8_t level;
+
+	if (input == INPUT_SWITCH_5V)
+		TCE0.INTCTRLB &= ~TC0_CCBINTLVL_gm;
+	else
+		TCE0.INTCTRLB &= ~TC0_CCAINTLVL_gm;
+
+	/* Sampled after the interrupt is back, so a later edge is not lost */
+	port->INTFLAGS = PORT_INT0IF_bm;
+	port->INTCTRL = (port->INTCTRL & ~PORT_INT0LVL_gm) | PORT_INT0LVL_LO_gc;
+	level = input_read(input);
+
+	if (level != input_level[input])
+		input_edge_push(input, level, input_first_ticks[input]);
+}
+
+/* Sets the user timestamp to the Harp time of 'ticks'. Returns false   */
+/* until the first Harp second is seen.                                 */
+static bool harp_user_timestamp(uint32_t ticks)
+{
+	uint32_t seconds;
+	int32_t dt;
+
+	if (!second_mark_valid)
+		return false;
+
+	seconds = second_mark;
+	dt = (int32_t)(ticks - second_mark_ticks);
+
+	while (dt < 0)
+	{
+		dt += 1000000L * PULSE_TICKS_PER_US;
+		seconds--;
+	}
+	while (dt >= 1000000L * PULSE_TICKS_PER_US)
+	{
+		dt -= 1000000L * PULSE_TICKS_PER_US;
+		seconds++;
+	}
+
+	/* Harp microseconds are counted in steps of 32 us */
+	core_func_update_user_timestamp(seconds, dt / (32 * PULSE_TICKS_PER_US));
+	return true;
+}
+
+/* Ticks of 'ticks' past the 32 us step its Harp timestamp is cut to */
+static uint8_t harp_timestamp_rest(uint32_t ticks)
+{
+	if (!second_mark_valid)
+		return 0;
+
+	/* A second is a whole number of steps, so this holds on either side */
+	return (ticks - second_mark_ticks) & (32 * PULSE_TICKS_PER_US - 1);
+}
+
+static void input_edge_event(input_edge_t *e)
+{
+	bool use_core_timestamp = !harp_user_timestamp(e->ticks);
+
+	if (e->input == INPUT_SWITCH_5V)
+	{
+		if (!(app_regs.REG_EVNT_ENABLE & B_EVT_SPAD_SWITCH))
+			return;
+
+		if (e->level)
+			set_MCU_TO_RELAY;
+		else
+			clr_MCU_TO_RELAY;
+
+		if (app_regs.REG_SPAD_SWITCH != e->level)
+		{
+			app_regs.REG_SPAD_SWITCH = e->level;
+			app_send_event(ADD_REG_SPAD_SWITCH, use_core_timestamp);
+		}
+	}
+	else
+	{
+		if (!(app_regs.REG_EVNT_ENABLE & B_EVT_LASER_STATE))
+			return;
+
+		if (app_regs.REG_LASER_STATE != e->level)
+		{
+			app_regs.REG_LASER_STATE = e->level;
+			app_send_event(ADD_REG_LASER_STATE, use_core_timestamp);
+		}
+	}
+}
+
+/* Called every millisecond */
+void input_edges_drain(void)
+{
+	uint8_t tail = input_edges_tail;
+
+	while (tail != input_edges_head)
+	{
+		input_edge_event(&input_edges[tail]);
+		tail = (tail + 1) & (INPUT_EDGES_SIZE - 1);
+		input_edges_tail = tail;
+	}
+}
+
+/************************************************************************/
+/* Interlock                                                            */
 /************************************************************************/
-void core_callback_catastrophic_error_detected(void)
+/* The key switch also drives a high level interrupt that turns the     */
+/* laser off as soon as the key goes off, ahead of the event path and   */
+/* of any debounce window: F1 to F3 and the channel outputs go low, the */
+/* trains and the pattern stop and the intensity goes to 0. While the   */
+/* key stays off, starts and laser settings other than 0 are refused.   */
+/* The key edge is routed through event channel 5 to a capture on TCD0  */
+/* CCB, so the reported latency starts at the edge itself.              */
+void interlock_init(void)
 {
-	
+	EVSYS.CH5MUX = EVSYS_CHMUX_PORTH_PIN0_gc;
+	TCD0.CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH4_gc;		// CCA from channel 4 (unused), CCB from channel 5, CCC from channel 6
+	TCD0.CTRLB |= TC0_CCBEN_bm;
+}
+
+/* Called from the key switch high level interrupt */
+void interlock_fire(void)
+{
+	uint16_t edge;
+
+	if (read_ON_OFF_KEY)
+		return;
+
+	/* The DMA would toggle the pins back on */
+	pattern_stop();
+
+	clr_F1;
+	clr_F2;
+	clr_F3;
+	PORTJ.OUTCLR = channels_to_pins(B_CH_ALL);
+
+	/* Reading CCB pulls the next capture from its buffer, the last one is the off edge */
+	do {
+		edge = TCD0.CCB;
+	} while (TCD0.INTFLAGS & TC0_CCBIF_bm);
+
+	app_regs.REG_INTERLOCK_LATENCY = (uint16_t)(TCD0.CNT - edge) / PULSE_TICKS_PER_US;
+
+	app_regs.REG_LASER_FREQUENCY_SELECT = 0;
+	app_regs.REG_LASER_POWER = 0;
+	app_regs.REG_LASER_INTENSITY = 0;
+	digipot_write(0);
+	intensity_sequence_stop();
+
+	pulse_channels_stop((1 << PULSE_CHANNELS) - 1);
+	app_regs.REG_BNCS_STATE = 0;
+	app_regs.REG_SIGNAL_STATE = 0;
+	app_regs.REG_CHANNELS_STATE = 0;
+	app_regs.REG_START_TIME_CHANNELS = 0;
 }
 
 /************************************************************************/
-/* User functions                                                       */
+/* Diagnostics                                                          */
 /************************************************************************/
-/* Add your functions here or load external functions if needed */
+/* TCF0 runs free at the CPU clock. The instrumented paths take a       */
+/* snapshot at entry and hand it to diag_end() at exit, which keeps the */
+/* min, max and a running mean (1/16 weight) of each path, in cycles,   */
+/* in the DIAGNOSTICS register. A path longer than 2 ms wraps.          */
+static uint8_t diag_seen = 0;	// one bit per path with at least one sample
+
+void diag_reset(void)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+
+	for (uint8_t path = 0; path < DIAG_PATHS; path++)
+	{
+		app_regs.REG_DIAGNOSTICS[path * 3 + 0] = 0;
+		app_regs.REG_DIAGNOSTICS[path * 3 + 1] = 0;
+		app_regs.REG_DIAGNOSTICS[path * 3 + 2] = 0;
+	}
+	diag_seen = 0;
+
+	SREG = sreg;
+}
+
+void diag_init(void)
+{
+	TCF0.CTRLA = TC_CLKSEL_OFF_gc;
+	TCF0.CTRLB = TC_WGMODE_NORMAL_gc;
+	TCF0.INTCTRLA = 0;
+	TCF0.INTCTRLB = 0;
+	TCF0.PER = 0xFFFF;
+	TCF0.CNT = 0;
+	TCF0.CTRLA = TC_CLKSEL_DIV1_gc;
+
+	diag_reset();
+}
+
+/* Interrupts are held since TCF0 is read from every interrupt level */
+uint16_t diag_now(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t now;
+
+	cli();
+	now = TCF0.CNT;
+	SREG = sreg;
 
-void update_digipot(uint8_t data, SPI_t* spi, PORT_t* cs_port, uint8_t cs_pin, PORT_t* spi_port){
+	return now;
+}
 
-	spi->CTRL = 0;
+void diag_end(uint8_t path, uint16_t start)
+{
+	uint8_t sreg = SREG;
+	uint16_t cycles;
+	uint16_t *stats = &app_regs.REG_DIAGNOSTICS[path * 3];
 
-	clear_io((*(PORT_t *)cs_port), cs_pin); //enable digipot
-    _8_CLOCK_CYCLES;
-	//Select channel 2 (01)
-	clear_io((*(PORT_t *)spi_port), 5); //B9 =0 MOSI
-	set_io((*(PORT_t *)spi_port), 5); //B8 =1 MOSI
+	cli();
 
-	set_io((*(PORT_t *)spi_port), 7); 
-    _8_CLOCK_CYCLES;        
-    clear_io((*(PORT_t *)spi_port), 7);
-    _8_CLOCK_CYCLES;
+	cycles = TCF0.CNT - start;
 
-    for (uint8_t i = 0; i < 8; i++)
-    {
-         if ((data<<i) & 0x80)
-            set_io((*(PORT_t *)spi_port), 5);
-         else
-            clear_io((*(PORT_t *)spi_port), 5);
-         
-         set_io((*(PORT_t *)spi_port), 7);
-         _8_CLOCK_CYCLES;
-         
-         clear_io((*(PORT_t *)spi_port), 7);
-         _8_CLOCK_CYCLES;
+	if (!(diag_seen & (1 << path)))
+	{
+		diag_seen |= (1 << path);
+		stats[0] = cycles;
+		stats[1] = cycles;
+		stats[2] = cycles;
+	}
+	else
+	{
+		if (cycles < stats[0]) stats[0] = cycles;
+		if (cycles > stats[1]) stats[1] = cycles;
+		stats[2] = (int32_t)stats[2] + (((int32_t)cycles - stats[2]) >> 4);
 	}
-	set_io((*(PORT_t *)cs_port), cs_pin);
 
+	SREG = sreg;
 }
 
-//Update and send event of digital SPAD_SWITCH register
-void spad_switch_events(uint8_t state){
-	uint8_t reg_spad_switch = app_regs.REG_SPAD_SWITCH;
-	if(state==1){
-		if(app_regs.REG_EVNT_ENABLE &  B_EVT_SPAD_SWITCH ){
-			app_regs.REG_SPAD_SWITCH = 1;
-			set_MCU_TO_RELAY;
-			if(reg_spad_switch != app_regs.REG_SPAD_SWITCH){
-				core_func_send_event(ADD_REG_SPAD_SWITCH, true);
-			}		 
-		}
+/************************************************************************/
+/* Write latency                                                        */
+/************************************************************************/
+/* Every register write takes the pulse engine time on entry. Writes    */
+/* with a physical effect arm the measurement, and the place where the  */
+/* effect happens (digipot latch, output change, start of the trains)   */
+/* bins the elapsed time into LATENCY_HISTOGRAM, log2 of microseconds.  */
+/* Trains end it at their start time t0, before any TAIL, so only the   */
+/* channels started by the write are counted.                           */
+static uint32_t latency_start;
+static volatile uint8_t latency_armed = LATENCY_NONE;
+
+void latency_reset(void)
+{
+	for (uint8_t i = 0; i < LATENCY_BINS; i++)
+		app_regs.REG_LATENCY_HISTOGRAM[i] = 0;
+}
+
+/* Called when a register write starts, with the time of its entry */
+void latency_write_start(uint8_t add, uint32_t entry)
+{
+	uint8_t kind;
+
+	switch (add)
+	{
+		case ADD_REG_LASER_INTENSITY:
+		case ADD_REG_LASER_POWER:
+			kind = LATENCY_DIGIPOT;
+			break;
+		case ADD_REG_OUTPUT_SET:
+		case ADD_REG_OUTPUT_CLEAR:
+		case ADD_REG_OUTPUT_TOGGLE:
+		case ADD_REG_OUTPUT_STATE:
+			kind = LATENCY_OUTPUT;
+			break;
+		case ADD_REG_BNCS_STATE:
+		case ADD_REG_SIGNAL_STATE:
+		case ADD_REG_CHANNELS_STATE:
+			kind = LATENCY_EDGE;
+			break;
+		default:
+			return;
 	}
-	else{
-		if(app_regs.REG_EVNT_ENABLE & B_EVT_SPAD_SWITCH ){
-			app_regs.REG_SPAD_SWITCH = 0;
-			clr_MCU_TO_RELAY;
-			if(reg_spad_switch != app_regs.REG_SPAD_SWITCH){
-				core_func_send_event(ADD_REG_SPAD_SWITCH, true);
-			}		
-		}
+
+	uint8_t sreg = SREG;
+	cli();
+	latency_start = entry;
+	latency_armed = kind;
+	SREG = sreg;
+}
+
+/* Called where an effect of type 'kind' happens */
+void latency_effect(uint8_t kind)
+{
+	latency_effect_at(kind, pulse_time_now());
+}
+
+/* Same, for an effect that happens at the engine time 'ticks' */
+void latency_effect_at(uint8_t kind, uint32_t ticks)
+{
+	uint8_t sreg = SREG;
+	uint32_t us;
+	uint8_t bin = 0;
+
+	if (latency_armed != kind)
+		return;
+
+	cli();
+
+	if (latency_armed != kind)
+	{
+		SREG = sreg;
+		return;
 	}
+
+	us = (ticks - latency_start) / PULSE_TICKS_PER_US;
+	latency_armed = LATENCY_NONE;
+
+	while (us && bin < LATENCY_BINS - 1)
+	{
+		us >>= 1;
+		bin++;
+	}
+
+	if (app_regs.REG_LATENCY_HISTOGRAM[bin] != 0xFFFF)
+		app_regs.REG_LATENCY_HISTOGRAM[bin]++;
+
+	SREG = sreg;
 }
 
+/* Called when a register write ends */
+void latency_write_end(bool ok)
+{
+	/* Nothing to wait for if the write failed or started no channel */
+	if (!ok || latency_armed == LATENCY_EDGE)
+		latency_armed = LATENCY_NONE;
+	else
+		latency_effect(LATENCY_OUTPUT);
+}
 
-void set_laser_freq(uint8_t value){
-	if(value == 0){
-		clr_F1;
-		clr_F2;
-		clr_F3;
-		app_regs.REG_LASER_FREQUENCY_SELECT = 0;
+/************************************************************************/
+/* Event output                                                         */
+/************************************************************************/
+/* Events are queued by the core in its UART TX ring. The ring indexes  */
+/* are read to keep the current fill and its high-water mark, and an    */
+/* event that would not fit is dropped and counted instead of sent.     */
+/* The time the host holds CTS is accumulated from the CTS interrupt.   */
+extern volatile uint16_t hwbp_uart_head, hwbp_uart_tail;
+
+static uint32_t cts_stall_start;
+static bool cts_stalled = false;
+
+void uart_tx_stats_reset(void)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+
+	app_regs.REG_UART_TX_STATS[0] = 0;
+	app_regs.REG_UART_TX_STATS[1] = 0;
+	app_regs.REG_UART_TX_STATS[2] = 0;
+	app_regs.REG_UART_TX_STATS[3] = 0;
+
+	if (cts_stalled)
+		cts_stall_start = pulse_time_now();
+
+	SREG = sreg;
+}
+
+/* Bytes waiting in the TX ring */
+uint16_t uart_tx_fill(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t head, tail;
+
+	cli();
+	head = hwbp_uart_head;
+	tail = hwbp_uart_tail;
+	SREG = sreg;
+
+	if (head >= tail)
+		return head - tail;
+	else
+		return head + HWBP_UART_TXBUFSIZ - tail;
+}
+
+/* Returns false, and counts the drop, when 'size' bytes don't fit */
+static bool uart_tx_room(uint16_t size)
+{
+	/* One byte of the ring is always left empty */
+	if (uart_tx_fill() + size >= HWBP_UART_TXBUFSIZ)
+	{
+		app_regs.REG_UART_TX_STATS[2]++;
+		return false;
 	}
-	if(value & B_F1){
-		set_F1;
-		clr_F2;
-		clr_F3;
-		app_regs.REG_LASER_FREQUENCY_SELECT = B_F1;
+
+	return true;
+}
+
+static void uart_tx_peak(void)
+{
+	uint16_t fill = uart_tx_fill();
+
+	if (fill > app_regs.REG_UART_TX_STATS[1])
+		app_regs.REG_UART_TX_STATS[1] = fill;
+}
+
+bool app_send_event(uint8_t add, bool use_core_timestamp)
+{
+	uint8_t i = add - APP_REGS_ADD_MIN;
+
+	if (!uart_tx_room(EVENT_OVERHEAD + (app_regs_type[i] & MSK_TYPE_LEN) * app_regs_n_elements[i]))
+		return false;
+
+	core_func_send_event(add, use_core_timestamp);
+	uart_tx_peak();
+
+	return true;
+}
+
+/* Sends an event of the U8 register 'add' carrying 'value' instead of  */
+/* the register content, which is left untouched.                       */
+bool app_send_event_u8(uint8_t add, uint8_t value, bool use_core_timestamp)
+{
+	uint8_t msg[EVENT_OVERHEAD + 1];
+	uint32_t seconds;
+	uint16_t useconds;
+	uint8_t checksum = 0;
+
+	if (!core_bool_device_is_active())
+		return false;
+
+	if (!uart_tx_room(sizeof(msg)))
+		return false;
+
+	if (use_core_timestamp)
+	{
+		seconds = core_func_read_R_TIMESTAMP_SECOND();
+		useconds = core_func_read_R_TIMESTAMP_MICRO();
 	}
-	if(value & B_F2){
-		clr_F1;
-		set_F2;
-		clr_F3;
-		app_regs.REG_LASER_FREQUENCY_SELECT = B_F2;
+	else
+		core_func_read_user_timestamp(&seconds, &useconds);
+
+	msg[0] = 3;								// Event
+	msg[1] = sizeof(msg) - 2;
+	msg[2] = add;
+	msg[3] = 255;							// port
+	msg[4] = TYPE_U8 | 0x10;				// with timestamp
+	*((uint32_t*)(msg + 5)) = seconds;
+	*((uint16_t*)(msg + 9)) = useconds;
+	msg[11] = value;
+
+	for (uint8_t i = 0; i < sizeof(msg) - 1; i++)
+		checksum += msg[i];
+	msg[sizeof(msg) - 1] = checksum;
+
+	hwbp_uart_xmit(msg, sizeof(msg));
+	uart_tx_peak();
+
+	return true;
+}
+
+/* Called from the CTS interrupt, CTS high holds the transmission */
+void uart_cts_changed(void)
+{
+	if (read_io(HWBP_UART_CTS_PORT, HWBP_UART_CTS_pin))
+	{
+		if (!cts_stalled)
+		{
+			cts_stall_start = pulse_time_now();
+			cts_stalled = true;
+		}
 	}
-	if(value & B_F3){
-		clr_F1;
-		clr_F2;
-		set_F3;
-		app_regs.REG_LASER_FREQUENCY_SELECT = B_F3;
+	else if (cts_stalled)
+	{
+		app_regs.REG_UART_TX_STATS[3] += (pulse_time_now() - cts_stall_start) / PULSE_TICKS_PER_US;
+		cts_stalled = false;
 	}
-	if(value & B_CW){
-		set_F1;
-		set_F2;
-		set_F3;
-		app_regs.REG_LASER_FREQUENCY_SELECT = B_CW;
+}
+
+/************************************************************************/
+/* Edge events                                                          */
+/************************************************************************/
+/* The pulse engine pushes every edge of the channels in                */
+/* EDGE_EVENTS_CHANNELS, with its scheduled time, into a ring. The 1 ms */
+/* callback packs them into EDGE_EVENTS, timestamped with the Harp time */
+/* of the first edge cut to 32 us, with the offsets counted from that   */
+/* same instant. The batch is sent when it is full or when its first    */
+/* edge has waited EDGE_EVENTS_LATENCY.                                 */
+static pulse_edge_t pulse_edges[PULSE_EDGES_SIZE];
+static volatile uint8_t pulse_edges_head = 0, pulse_edges_tail = 0;
+
+static uint8_t edge_batch_count = 0;
+static uint32_t edge_batch_start;
+
+/* Called from the pulse engine, the edge is lost if the ring is full */
+void edge_event_push(uint8_t ch, bool rising, uint32_t ticks)
+{
+	uint8_t head = pulse_edges_head;
+	uint8_t next = (head + 1) & (PULSE_EDGES_SIZE - 1);
+
+	if (next == pulse_edges_tail)
+		return;
+
+	pulse_edges[head].channel = ch;
+	pulse_edges[head].level = rising ? 1 : 0;
+	pulse_edges[head].ticks = ticks;
+	pulse_edges_head = next;
+}
+
+static void edge_batch_send(void)
+{
+	bool use_core_timestamp = !harp_user_timestamp(edge_batch_start);
+
+	for (uint8_t i = edge_batch_count; i < EDGE_EVENTS_LENGTH; i++)
+		app_regs.REG_EDGE_EVENTS[i] = EDGE_EVENT_EMPTY;
+
+	app_send_event(ADD_REG_EDGE_EVENTS, use_core_timestamp);
+	edge_batch_count = 0;
+}
+
+/* Called every millisecond */
+void edge_events_poll(void)
+{
+	uint8_t tail = pulse_edges_tail;
+
+	while (tail != pulse_edges_head)
+	{
+		pulse_edge_t *e = &pulse_edges[tail];
+
+		/* Offsets count from the instant the event timestamp stands for */
+		if (edge_batch_count == 0)
+			edge_batch_start = e->ticks - harp_timestamp_rest(e->ticks);
+
+		app_regs.REG_EDGE_EVENTS[edge_batch_count++] =
+			((uint32_t)e->level << 31) |
+			((uint32_t)e->channel << 28) |
+			(((e->ticks - edge_batch_start) / PULSE_TICKS_PER_US) & EDGE_EVENT_OFFSET_MASK);
+
+		tail = (tail + 1) & (PULSE_EDGES_SIZE - 1);
+		pulse_edges_tail = tail;
+
+		if (edge_batch_count == EDGE_EVENTS_LENGTH)
+			edge_batch_send();
 	}
 
+	if (edge_batch_count &&
+		pulse_time_now() - edge_batch_start >= app_regs.REG_EDGE_EVENTS_LATENCY * 1000UL * PULSE_TICKS_PER_US)
+		edge_batch_send();
 }
 
+/************************************************************************/
+/* State events                                                         */
+/************************************************************************/
+/* Starts and train ends push the new BNCS_STATE or SIGNAL_STATE value, */
+/* with the engine time of the change, into a ring. The 1 ms callback   */
+/* sends one event per change with that value and the Harp time of the  */
+/* change, so a start and an end in the same millisecond are both seen. */
+static state_change_t state_changes[STATE_CHANGES_SIZE];
+static volatile uint8_t state_changes_head = 0, state_changes_tail = 0;
 
+static void state_change_push_one(uint8_t add, uint8_t value, uint32_t ticks)
+{
+	uint8_t head = state_changes_head;
+	uint8_t next = (head + 1) & (STATE_CHANGES_SIZE - 1);
 
+	if (next == state_changes_tail)
+		return;
 
+	state_changes[head].add = add;
+	state_changes[head].value = value;
+	state_changes[head].ticks = ticks;
+	state_changes_head = next;
+}
 
+/* Called with interrupts held when the channels in 'mask' start or end */
+void state_change_push(uint8_t mask, uint32_t ticks)
+{
+	if ((mask & (B_CH_BNC1 | B_CH_BNC2)) && (app_regs.REG_EVNT_ENABLE & B_EVT_BNCS_STATE))
+		state_change_push_one(ADD_REG_BNCS_STATE, app_regs.REG_BNCS_STATE, ticks);
 
+	if ((mask & (B_CH_SIGNAL_A | B_CH_SIGNAL_B)) && (app_regs.REG_EVNT_ENABLE & B_EVT_SIGNAL_STATE))
+		state_change_push_one(ADD_REG_SIGNAL_STATE, app_regs.REG_SIGNAL_STATE, ticks);
+}
 
+/* Called every millisecond */
+void state_changes_drain(void)
+{
+	uint8_t tail = state_changes_tail;
 
+	while (tail != state_changes_head)
+	{
+		state_change_t *e = &state_changes[tail];
+		bool use_core_timestamp = !harp_user_timestamp(e->ticks);
 
+		/* The event carries the value at the change, not a later one */
+		app_send_event_u8(e->add, e->value, use_core_timestamp);
 
+		tail = (tail + 1) & (STATE_CHANGES_SIZE - 1);
+		state_changes_tail = tail;
+	}
+}
 
 /************************************************************************/
 /* Initialization Callbacks                                             */
@@ -195,7 +1614,15 @@ void core_callback_initialize_hardware(void)
 	clr_RESET;*/
 	_delay_ms(10);
 	/* Initialize hardware */
-	update_digipot(0, &SPID, &PORTD, 4, &PORTD);
+	digipot_init();
+	digipot_write(0);
+	pulse_timer_init();
+	input_debounce_init();
+	interlock_init();
+	scheduled_start_init();
+	diag_init();
+	latency_reset();
+	uart_tx_stats_reset();
 }
 void core_callback_1st_config_hw_after_boot(void)
 {
@@ -214,7 +1641,15 @@ void core_callback_1st_config_hw_after_boot(void)
 	_delay_ms(1);
 	clr_RESET;*/
 	_delay_ms(10);
-	update_digipot(0, &SPID, &PORTD, 4, &PORTD);
+	digipot_init();
+	digipot_write(0);
+	pulse_timer_init();
+	input_debounce_init();
+	interlock_init();
+	scheduled_start_init();
+	diag_init();
+	latency_reset();
+	uart_tx_stats_reset();
 }
 
 void core_callback_reset_registers(void)
@@ -253,13 +1688,76 @@ void core_callback_reset_registers(void)
 	app_regs.REG_SIGNAL_B_TAIL = 0;
 	
 	app_regs.REG_EVNT_ENABLE = B_EVT_SPAD_SWITCH | B_EVT_LASER_STATE; //enable events
+	app_regs.REG_BNC0_ON_US = 0;
+	app_regs.REG_BNC0_OFF_US = 0;
+	app_regs.REG_BNC0_TAIL_US = 0;
+	app_regs.REG_BNC1_ON_US = 0;
+	app_regs.REG_BNC1_OFF_US = 0;
+	app_regs.REG_BNC1_TAIL_US = 0;
+	app_regs.REG_SIGNAL_A_ON_US = 0;
+	app_regs.REG_SIGNAL_A_OFF_US = 0;
+	app_regs.REG_SIGNAL_A_TAIL_US = 0;
+	app_regs.REG_SIGNAL_B_ON_US = 0;
+	app_regs.REG_SIGNAL_B_OFF_US = 0;
+	app_regs.REG_SIGNAL_B_TAIL_US = 0;
+	for (uint8_t i = 0; i < 32; i++)
+		app_regs.REG_BNC0_SEQUENCE[i] = 0;
+	for (uint8_t i = 0; i < 32; i++)
+		app_regs.REG_BNC1_SEQUENCE[i] = 0;
+	for (uint8_t i = 0; i < 32; i++)
+		app_regs.REG_SIGNAL_A_SEQUENCE[i] = 0;
+	for (uint8_t i = 0; i < 32; i++)
+		app_regs.REG_SIGNAL_B_SEQUENCE[i] = 0;
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_SEQUENCE_LOOPS[i] = 0;
+	app_regs.REG_SEQUENCE_ENABLE = 0;
+	for (uint8_t i = 0; i < 128; i++)
+		app_regs.REG_PATTERN[i] = 0;
+	app_regs.REG_PATTERN_LENGTH = 0;
+	app_regs.REG_PATTERN_SLOT = 10;
+	app_regs.REG_PATTERN_LOOPS = 0;
+	app_regs.REG_PATTERN_STATE = 0;
+	app_regs.REG_CHANNELS_STATE = 0;
+	app_regs.REG_TRIGGER_MODE = GM_TRIGGER_DISABLED;
+	app_regs.REG_TRIGGER_CHANNELS = 0;
+	for (uint8_t i = 0; i < 2; i++)
+		app_regs.REG_START_TIME[i] = 0;
+	app_regs.REG_START_TIME_CHANNELS = 0;
+	for (uint8_t i = 0; i < 128; i++)
+		app_regs.REG_INTENSITY_SEQUENCE[i] = 0;
+	app_regs.REG_INTENSITY_SEQUENCE_LENGTH = 0;
+	app_regs.REG_INTENSITY_SEQUENCE_CHANNEL = 0;
+	/* Identity, a reset to defaults also drops the saved calibration */
+	for (uint8_t i = 0; i < 128; i++)
+		app_regs.REG_INTENSITY_LUT_LOW[i] = i;
+	for (uint8_t i = 0; i < 128; i++)
+		app_regs.REG_INTENSITY_LUT_HIGH[i] = 128 + i;
+	app_regs.REG_LASER_POWER = 0;
+	app_regs.REG_TIMING_UPDATE_MODE = GM_TIMING_IMMEDIATE;
+	app_regs.REG_TIMING_COMMIT = 0;
+	app_regs.REG_SPAD_SWITCH_DEBOUNCE = 0;
+	app_regs.REG_LASER_STATE_DEBOUNCE = 0;
+	app_regs.REG_INTERLOCK_LATENCY = 0;
+	app_regs.REG_DIAGNOSTICS_RESET = 0;
+	for (uint8_t i = 0; i < 16; i++)
+		app_regs.REG_EDGE_EVENTS[i] = EDGE_EVENT_EMPTY;
+	app_regs.REG_EDGE_EVENTS_CHANNELS = 0;
+	app_regs.REG_EDGE_EVENTS_LATENCY = 10;
 	
 }
 
 void core_callback_registers_were_reinitialized(void)
 {
 	/* Update registers if needed */
-	
+	commit_channels(B_CH_ALL);
+	trigger_config();
+
+	/* Nothing runs or is armed after a boot, whatever was saved */
+	app_regs.REG_BNCS_STATE = 0;
+	app_regs.REG_SIGNAL_STATE = 0;
+	app_regs.REG_CHANNELS_STATE = 0;
+	app_regs.REG_PATTERN_STATE = 0;
+	app_regs.REG_START_TIME_CHANNELS = 0;
 }
 
 /************************************************************************/
@@ -282,12 +1780,16 @@ void core_callback_visualen_to_off(void)
 /************************************************************************/
 void core_callback_device_to_standby(void) {
 	
+	pattern_stop();
+	app_regs.REG_START_TIME_CHANNELS = 0;
+	
 	app_regs.REG_BNCS_STATE = 0;
 	app_write_REG_BNCS_STATE(&app_regs.REG_BNCS_STATE);
 	
 	app_regs.REG_SIGNAL_STATE = 0;
 	app_write_REG_SIGNAL_STATE(&app_regs.REG_SIGNAL_STATE);
 	
+	app_regs.REG_LASER_POWER = 0;
 	app_regs.REG_LASER_INTENSITY = 0;
 	app_write_REG_LASER_INTENSITY(&app_regs.REG_LASER_INTENSITY);
 	
@@ -304,236 +1806,27 @@ void core_callback_device_to_speed(void) {}
 /************************************************************************/
 void core_callback_t_before_exec(void) {}
 void core_callback_t_after_exec(void) {}
-void core_callback_t_new_second(void) {}
+void core_callback_t_new_second(void) {
+	scheduled_start_new_second();
+}
 void core_callback_t_500us(void) {
-
-	//----------------------------BNC SIGNAL 1-----------------------------
-	//counts delay time before start signal
-	if (app_regs.REG_BNCS_STATE & B_BNC0){
-	if ((pulse_countdown.tail_bnc0)  > 0 && (app_regs.REG_BNC0_ON != 0)){	
-			if (--pulse_countdown.tail_bnc0 == 0){
-				set_BNC_SIG1_O;
-			}
-	}
-	else{	
-		//BNC 0 signal
-		if (pulse_countdown.t_bnc0  > 0){	
-			//--pulse_countdown.tail_bnc0;
-			--pulse_countdown.period_bnc0;
-			if (--pulse_countdown.t_bnc0 == 0){
-				//if(pulse_countdown.tail_bnc0 == 0){ //ends pulse, goes to ON part of signal or stops the signal
-				if(pulse_countdown.period_bnc0 == 0){ //ends pulse, goes to ON part of signal or stops the signal
-					if( --pulse_countdown.count_pulses_bnc0 > 1  ){
-					
-						//pulse_countdown.tail_bnc0 = s_bnc_0.tail_ms ; //set the tail value
-						pulse_countdown.period_bnc0 = s_bnc_0.on_ms + s_bnc_0.off_ms   ; //set the period value
-						pulse_countdown.t_bnc0 = s_bnc_0.on_ms ;			
-						set_BNC_SIG1_O;	
-					}
-					else if (pulse_countdown.count_pulses_bnc0 == 1){ //end
-						clr_BNC_SIG1_O;
-						app_regs.REG_BNCS_STATE &= ~B_BNC0; //stops signal
-					}
-					else{ //infinite pulses
-						//pulse_countdown.tail_bnc0 = s_bnc_0.tail_ms; //set the tail value
-						pulse_countdown.period_bnc0 =s_bnc_0.on_ms + s_bnc_0.off_ms; //set the period value
-						pulse_countdown.t_bnc0 = s_bnc_0.on_ms ;
-						pulse_countdown.count_pulses_bnc0 = 1;
-						set_BNC_SIG1_O;	
-					}				
-				}
-				else{ //goes to off part of signal
-					pulse_countdown.t_bnc0 =  s_bnc_0.off_ms;
-					clr_BNC_SIG1_O;
-				}
-			}		
-		}
-	}
-	}
-
-	//----------------------------BNC SIGNAL 2-----------------------------
-	//counts delay time before start signal
-	if (app_regs.REG_BNCS_STATE & B_BNC1){
-	if ((pulse_countdown.tail_bnc1  > 0) && (app_regs.REG_BNC1_ON != 0)){
-		if (--pulse_countdown.tail_bnc1 == 0 ){
-			set_BNC_SIG2_O;
-		}
-	}
-	else{
-		//BNC 1 signal
-		if (pulse_countdown.t_bnc1  > 0){
-			//--pulse_countdown.tail_bnc1;
-			--pulse_countdown.period_bnc1;
-			if (--pulse_countdown.t_bnc1 == 0){
-				//if(pulse_countdown.tail_bnc1 == 0){ //ends pulse, goes to ON part of signal or stops the signal
-				if(pulse_countdown.period_bnc1 == 0){ //ends pulse, goes to ON part of signal or stops the signal
-					if( --pulse_countdown.count_pulses_bnc1 > 1  ){
-					
-						//pulse_countdown.tail_bnc1 = s_bnc_1.tail_ms ; //set the tail value
-						pulse_countdown.period_bnc1 = s_bnc_1.on_ms + s_bnc_1.off_ms   ; //set the period value
-						pulse_countdown.t_bnc1 = s_bnc_1.on_ms ;
-						set_BNC_SIG2_O;
-					}
-					else if (pulse_countdown.count_pulses_bnc1 == 1){ //end
-						clr_BNC_SIG2_O;
-						app_regs.REG_BNCS_STATE &= ~B_BNC1; //stops signal
-					}
-					else{ //infinite pulses
-						//pulse_countdown.tail_bnc1 = s_bnc_1.tail_ms; //set the tail value
-						pulse_countdown.period_bnc1 = s_bnc_1.on_ms + s_bnc_1.off_ms; //set the period value
-						pulse_countdown.t_bnc1 = s_bnc_1.on_ms ;
-						pulse_countdown.count_pulses_bnc1 = 1;
-						set_BNC_SIG2_O;
-					}
-				}
-				else{ //goes to off part of signal
-					pulse_countdown.t_bnc1 =  s_bnc_1.off_ms;
-					clr_BNC_SIG2_O;
-				}
-			}
-		}
-	}
-	}
-
-	//----------------------------SIGNAL A-----------------------------
-	//counts delay time before start signal
-	if (app_regs.REG_SIGNAL_STATE & B_SIGNAL_A){
-	if ((pulse_countdown.tail_signal_a  > 0) && (app_regs.REG_SIGNAL_A_ON != 0)){
-		if (--pulse_countdown.tail_signal_a == 0 ){
-			set_SIGNAL_A_O;
-		}
-	}
-	else{
-		// signalA
-		if (pulse_countdown.t_signal_a  > 0){
-			//--pulse_countdown.tail_bnc1;
-			--pulse_countdown.period_signal_a;
-			if (--pulse_countdown.t_signal_a == 0){
-				//if(pulse_countdown.tail_bnc1 == 0){ //ends pulse, goes to ON part of signal or stops the signal
-				if(pulse_countdown.period_signal_a == 0){ //ends pulse, goes to ON part of signal or stops the signal
-					if( --pulse_countdown.count_pulses_signal_a > 1  ){
-						
-						//pulse_countdown.tail_bnc1 = s_bnc_1.tail_ms ; //set the tail value
-						pulse_countdown.period_signal_a = s_signal_a.on_ms + s_signal_a.off_ms   ; //set the period value
-						pulse_countdown.t_signal_a = s_signal_a.on_ms ;
-						set_SIGNAL_A_O;
-					}
-					else if (pulse_countdown.count_pulses_signal_a == 1){ //end
-						clr_SIGNAL_A_O;
-						app_regs.REG_SIGNAL_STATE &= ~B_SIGNAL_A; //stops signal
-					}
-					else{ //infinite pulses
-						//pulse_countdown.tail_bnc1 = s_bnc_1.tail_ms; //set the tail value
-						pulse_countdown.period_signal_a = s_signal_a.on_ms + s_signal_a.off_ms; //set the period value
-						pulse_countdown.t_signal_a = s_signal_a.on_ms ;
-						pulse_countdown.count_pulses_signal_a = 1;
-						set_SIGNAL_A_O;
-					}
-				}
-				else{ //goes to off part of signal
-					pulse_countdown.t_signal_a =  s_signal_a.off_ms;
-					clr_SIGNAL_A_O;
-				}
-			}
-		}
-	}
+	uint16_t diag_start = diag_now();
 	
-	}
-	//----------------------------SIGNAL B-----------------------------
-	//counts delay time before start signal
-	if (app_regs.REG_SIGNAL_STATE & B_SIGNAL_B){
-	if ((pulse_countdown.tail_signal_b  > 0) && (app_regs.REG_SIGNAL_B_ON != 0)){
-		if (--pulse_countdown.tail_signal_b == 0 ){
-			set_SIGNAL_B_O;
-		}
-	}
-	else{
-		// signalA
-		if (pulse_countdown.t_signal_b  > 0){
-			//--pulse_countdown.tail_bnc1;
-			--pulse_countdown.period_signal_b;
-			if (--pulse_countdown.t_signal_b == 0){
-				//if(pulse_countdown.tail_bnc1 == 0){ //ends pulse, goes to ON part of signal or stops the signal
-				if(pulse_countdown.period_signal_b == 0){ //ends pulse, goes to ON part of signal or stops the signal
-					if( --pulse_countdown.count_pulses_signal_b > 1  ){
-						
-						//pulse_countdown.tail_bnc1 = s_bnc_1.tail_ms ; //set the tail value
-						pulse_countdown.period_signal_b = s_signal_b.on_ms + s_signal_b.off_ms   ; //set the period value
-						pulse_countdown.t_signal_b = s_signal_b.on_ms ;
-						set_SIGNAL_B_O;
-					}
-					else if (pulse_countdown.count_pulses_signal_b == 1){ //end
-						clr_SIGNAL_B_O;
-						app_regs.REG_SIGNAL_STATE &= ~B_SIGNAL_B; //stops signal
-					}
-					else{ //infinite pulses
-						//pulse_countdown.tail_bnc1 = s_bnc_1.tail_ms; //set the tail value
-						pulse_countdown.period_signal_b = s_signal_b.on_ms + s_signal_b.off_ms; //set the period value
-						pulse_countdown.t_signal_b = s_signal_b.on_ms ;
-						pulse_countdown.count_pulses_signal_b = 1;
-						set_SIGNAL_B_O;
-					}
-				}
-				else{ //goes to off part of signal
-					pulse_countdown.t_signal_b =  s_signal_b.off_ms;
-					clr_SIGNAL_B_O;
-				}
-			}
-		}
-	}
-	}
-			
+	diag_end(DIAG_T_500US, diag_start);
 }
 void core_callback_t_1ms(void) {
+	uint16_t diag_start = diag_now();
 	
-	//spad switch event from interrupt
+	scheduled_start_poll();
 	
-	if (app_regs.REG_RESERVED1 == 2){
-		uint8_t reg_spad_switch = app_regs.REG_SPAD_SWITCH;
-		if(read_SWITCH_5V){
-			if(app_regs.REG_EVNT_ENABLE &  B_EVT_SPAD_SWITCH ){
-				app_regs.REG_SPAD_SWITCH = 1;
-				set_MCU_TO_RELAY;
-				if(reg_spad_switch  != app_regs.REG_SPAD_SWITCH){
-					core_func_send_event(ADD_REG_SPAD_SWITCH, true);
-				}
-			}
-		}
-		else{
-			if(app_regs.REG_EVNT_ENABLE & B_EVT_SPAD_SWITCH ){
-				app_regs.REG_SPAD_SWITCH = 0;
-				clr_MCU_TO_RELAY;
-				if(reg_spad_switch != app_regs.REG_SPAD_SWITCH){
-					core_func_send_event(ADD_REG_SPAD_SWITCH, true);
-				}
-			}
-		}
-		app_regs.REG_RESERVED1 = 0;
-		
-	}
+	//spad switch and key switch events from interrupts
+	input_edges_drain();
 	
-	//key switch event from interrupt
-	if (app_regs.REG_RESERVED2 == 2){
-		uint8_t reg_laser_state = app_regs.REG_LASER_STATE;
-		if(read_ON_OFF_KEY){
-			if(app_regs.REG_EVNT_ENABLE & B_EVT_LASER_STATE ){
-				app_regs.REG_LASER_STATE = 1;
-				if(reg_laser_state != app_regs.REG_LASER_STATE){
-					core_func_send_event(ADD_REG_LASER_STATE, true);
-				}
-			}
-		}
-		else{
-			if(app_regs.REG_EVNT_ENABLE & B_EVT_LASER_STATE ){
-				app_regs.REG_LASER_STATE = 0;
-				if(reg_laser_state != app_regs.REG_LASER_STATE){
-					core_func_send_event(ADD_REG_LASER_STATE, true);
-				}
-			}
-		}
-		app_regs.REG_RESERVED2 =0;
-	}
+	edge_events_poll();
 	
+	state_changes_drain();
+	
+	diag_end(DIAG_T_1MS, diag_start);
 }
 
 
@@ -554,7 +1847,9 @@ void core_callback_uart_rx_before_exec(void) {}
 void core_callback_uart_rx_after_exec(void) {}
 void core_callback_uart_tx_before_exec(void) {}
 void core_callback_uart_tx_after_exec(void) {}
-void core_callback_uart_cts_before_exec(void) {}
+void core_callback_uart_cts_before_exec(void) {
+	uart_cts_changed();
+}
 void core_callback_uart_cts_after_exec(void) {}
 
 /************************************************************************/
@@ -571,7 +1866,7 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 		return false;
 	
 	/* Receive data */
-	(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();	
+	((void (*)(void))pgm_read_ptr(&app_func_rd_pointer[add-APP_REGS_ADD_MIN]))();
 
 	/* Return success */
 	return true;
@@ -582,6 +1877,8 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 /************************************************************************/
 bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint16_t n_elements)
 {
+	uint32_t entry = pulse_time_now();
+
 	/* Check if it will not access forbidden memory */
 	if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
 		return false;
@@ -595,5 +1892,11 @@ bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint1
 		return false;
 
 	/* Process data and return false if write is not allowed or contains errors */
-	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+	uint16_t diag_start = diag_now();
+	latency_write_start(add, entry);
+	bool ok = ((bool (*)(void*))pgm_read_ptr(&app_func_wr_pointer[add-APP_REGS_ADD_MIN]))(content);
+	latency_write_end(ok);
+	diag_end(DIAG_REG_WRITE, diag_start);
+
+	return ok;
 }
\ No newline at end of file
@@ -8,18 +8,27 @@
 #include "WS2812S.h"
 #include "structs.h"
 
-extern interval_t s_bnc_0, s_bnc_1, s_signal_a, s_signal_b;
-extern countdown_t pulse_countdown;
+extern channel_t channels[];
+extern volatile uint8_t pulse_running;
+extern uint8_t pulse_first_high_pins;
 extern ports_state_t state_on_or_off;
 //ports_state_t _states_;
 /************************************************************************/
 /* Create pointers to functions                                         */
 /************************************************************************/
 extern AppRegs app_regs;
-void start_signal(interval_t *signal, uint16_t t_on_ms, uint16_t n_pulses, uint16_t t_off_ms, uint16_t t_tail_ms);
-
-
-void (*app_func_rd_pointer[])(void) = {
+void start_signal(interval_t *signal, uint32_t t_on_us, uint16_t n_pulses, uint32_t t_off_us, uint32_t t_tail_us);
+void set_channels(uint8_t start_mask, uint8_t affected_mask);
+void reload_channel(uint8_t ch);
+void write_channel_config(uint8_t ch, uint16_t *cfg);
+bool pulse_time_us_is_valid(uint32_t us);
+
+
+/* Kept in flash, only app.c reads them, through pgm_read_ptr(). The    */
+/* Harp generator only produces app_ios_and_regs.h from device.yml,     */
+/* so both tables are kept by hand in address order and checked         */
+/* against the register count below.                                    */
+void (* const app_func_rd_pointer[])(void) PROGMEM = {
 	&app_read_REG_SPAD_SWITCH,
 	&app_read_REG_LASER_STATE,
 	&app_read_REG_RESERVED0,
@@ -50,10 +59,61 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_SIGNAL_B_OFF,
 	&app_read_REG_SIGNAL_B_PULSES,
 	&app_read_REG_SIGNAL_B_TAIL,
-	&app_read_REG_EVNT_ENABLE
+	&app_read_REG_EVNT_ENABLE,
+	&app_read_REG_BNC0_ON_US,
+	&app_read_REG_BNC0_OFF_US,
+	&app_read_REG_BNC0_TAIL_US,
+	&app_read_REG_BNC1_ON_US,
+	&app_read_REG_BNC1_OFF_US,
+	&app_read_REG_BNC1_TAIL_US,
+	&app_read_REG_SIGNAL_A_ON_US,
+	&app_read_REG_SIGNAL_A_OFF_US,
+	&app_read_REG_SIGNAL_A_TAIL_US,
+	&app_read_REG_SIGNAL_B_ON_US,
+	&app_read_REG_SIGNAL_B_OFF_US,
+	&app_read_REG_SIGNAL_B_TAIL_US,
+	&app_read_REG_BNC0_SEQUENCE,
+	&app_read_REG_BNC1_SEQUENCE,
+	&app_read_REG_SIGNAL_A_SEQUENCE,
+	&app_read_REG_SIGNAL_B_SEQUENCE,
+	&app_read_REG_SEQUENCE_LOOPS,
+	&app_read_REG_SEQUENCE_ENABLE,
+	&app_read_REG_PATTERN,
+	&app_read_REG_PATTERN_LENGTH,
+	&app_read_REG_PATTERN_SLOT,
+	&app_read_REG_PATTERN_LOOPS,
+	&app_read_REG_PATTERN_STATE,
+	&app_read_REG_CHANNELS_STATE,
+	&app_read_REG_TRIGGER_MODE,
+	&app_read_REG_TRIGGER_CHANNELS,
+	&app_read_REG_START_TIME,
+	&app_read_REG_START_TIME_CHANNELS,
+	&app_read_REG_INTENSITY_SEQUENCE,
+	&app_read_REG_INTENSITY_SEQUENCE_LENGTH,
+	&app_read_REG_INTENSITY_SEQUENCE_CHANNEL,
+	&app_read_REG_INTENSITY_LUT_LOW,
+	&app_read_REG_INTENSITY_LUT_HIGH,
+	&app_read_REG_LASER_POWER,
+	&app_read_REG_BNC0_CONFIG,
+	&app_read_REG_BNC1_CONFIG,
+	&app_read_REG_SIGNAL_A_CONFIG,
+	&app_read_REG_SIGNAL_B_CONFIG,
+	&app_read_REG_CHANNELS_CONFIG,
+	&app_read_REG_TIMING_UPDATE_MODE,
+	&app_read_REG_TIMING_COMMIT,
+	&app_read_REG_SPAD_SWITCH_DEBOUNCE,
+	&app_read_REG_LASER_STATE_DEBOUNCE,
+	&app_read_REG_INTERLOCK_LATENCY,
+	&app_read_REG_DIAGNOSTICS,
+	&app_read_REG_DIAGNOSTICS_RESET,
+	&app_read_REG_LATENCY_HISTOGRAM,
+	&app_read_REG_UART_TX_STATS,
+	&app_read_REG_EDGE_EVENTS,
+	&app_read_REG_EDGE_EVENTS_CHANNELS,
+	&app_read_REG_EDGE_EVENTS_LATENCY
 };
 
-bool (*app_func_wr_pointer[])(void*) = {
+bool (* const app_func_wr_pointer[])(void*) PROGMEM = {
 	&app_write_REG_SPAD_SWITCH,
 	&app_write_REG_LASER_STATE,
 	&app_write_REG_RESERVED0,
@@ -84,9 +144,63 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_SIGNAL_B_OFF,
 	&app_write_REG_SIGNAL_B_PULSES,
 	&app_write_REG_SIGNAL_B_TAIL,
-	&app_write_REG_EVNT_ENABLE
+	&app_write_REG_EVNT_ENABLE,
+	&app_write_REG_BNC0_ON_US,
+	&app_write_REG_BNC0_OFF_US,
+	&app_write_REG_BNC0_TAIL_US,
+	&app_write_REG_BNC1_ON_US,
+	&app_write_REG_BNC1_OFF_US,
+	&app_write_REG_BNC1_TAIL_US,
+	&app_write_REG_SIGNAL_A_ON_US,
+	&app_write_REG_SIGNAL_A_OFF_US,
+	&app_write_REG_SIGNAL_A_TAIL_US,
+	&app_write_REG_SIGNAL_B_ON_US,
+	&app_write_REG_SIGNAL_B_OFF_US,
+	&app_write_REG_SIGNAL_B_TAIL_US,
+	&app_write_REG_BNC0_SEQUENCE,
+	&app_write_REG_BNC1_SEQUENCE,
+	&app_write_REG_SIGNAL_A_SEQUENCE,
+	&app_write_REG_SIGNAL_B_SEQUENCE,
+	&app_write_REG_SEQUENCE_LOOPS,
+	&app_write_REG_SEQUENCE_ENABLE,
+	&app_write_REG_PATTERN,
+	&app_write_REG_PATTERN_LENGTH,
+	&app_write_REG_PATTERN_SLOT,
+	&app_write_REG_PATTERN_LOOPS,
+	&app_write_REG_PATTERN_STATE,
+	&app_write_REG_CHANNELS_STATE,
+	&app_write_REG_TRIGGER_MODE,
+	&app_write_REG_TRIGGER_CHANNELS,
+	&app_write_REG_START_TIME,
+	&app_write_REG_START_TIME_CHANNELS,
+	&app_write_REG_INTENSITY_SEQUENCE,
+	&app_write_REG_INTENSITY_SEQUENCE_LENGTH,
+	&app_write_REG_INTENSITY_SEQUENCE_CHANNEL,
+	&app_write_REG_INTENSITY_LUT_LOW,
+	&app_write_REG_INTENSITY_LUT_HIGH,
+	&app_write_REG_LASER_POWER,
+	&app_write_REG_BNC0_CONFIG,
+	&app_write_REG_BNC1_CONFIG,
+	&app_write_REG_SIGNAL_A_CONFIG,
+	&app_write_REG_SIGNAL_B_CONFIG,
+	&app_write_REG_CHANNELS_CONFIG,
+	&app_write_REG_TIMING_UPDATE_MODE,
+	&app_write_REG_TIMING_COMMIT,
+	&app_write_REG_SPAD_SWITCH_DEBOUNCE,
+	&app_write_REG_LASER_STATE_DEBOUNCE,
+	&app_write_REG_INTERLOCK_LATENCY,
+	&app_write_REG_DIAGNOSTICS,
+	&app_write_REG_DIAGNOSTICS_RESET,
+	&app_write_REG_LATENCY_HISTOGRAM,
+	&app_write_REG_UART_TX_STATS,
+	&app_write_REG_EDGE_EVENTS,
+	&app_write_REG_EDGE_EVENTS_CHANNELS,
+	&app_write_REG_EDGE_EVENTS_LATENCY
 };
 
+_Static_assert(sizeof(app_func_rd_pointer) / sizeof(app_func_rd_pointer[0]) == APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1, "app_func_rd_pointer doesn't match the register count");
+_Static_assert(sizeof(app_func_wr_pointer) / sizeof(app_func_wr_pointer[0]) == APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1, "app_func_wr_pointer doesn't match the register count");
+
 /*#define start_BNC_SIG1_O do {set_BNC_SIG1_O; if (app_regs.REG_BNC_STATE & B_BNC0) pulse_countdown.bnc_0 = app_regs.REG_BNC0_ON + 1; } while(0)
 #define start_BNC_SIG2_O do {set_BNC_SIG2_O; if (app_regs.REG_BNC_STATE & B_BNC1) pulse_countdown.bnc_1 = app_regs.REG_BNC1_ON + 1; } while(0)
 #define start_SIGNAL_A_O do {set_SIGNAL_A_O; if (app_regs.REG_SIGNAL_STATE & B_SIGNAL_A) pulse_countdown.signal_a = app_regs.REG_SIGNAL_A_ON + 1; } while(0)
@@ -219,6 +333,10 @@ void app_read_REG_LASER_FREQUENCY_SELECT(void)
 bool app_write_REG_LASER_FREQUENCY_SELECT(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+
+	if (reg && !read_ON_OFF_KEY)
+		return false;
+
 	//1-F1, 2-F2, 4-F3, 7-CW
 	if(reg==0 || reg==1 || reg==2 || reg==4 || reg==8){
 		set_laser_freq(reg);
@@ -243,9 +361,12 @@ bool app_write_REG_LASER_INTENSITY(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 
+	if (reg && !read_ON_OFF_KEY)
+		return false;
+
 	if( (reg >= 0) && (reg <= 255) ){
 		app_regs.REG_LASER_INTENSITY = reg;
-		update_digipot(app_regs.REG_LASER_INTENSITY, &SPID, &PORTD, 4, &PORTD); 
+		digipot_write(app_regs.REG_LASER_INTENSITY);
 	}
 
 	return true;
@@ -359,40 +480,14 @@ bool app_write_REG_BNCS_STATE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 
-//BNC 0
-	if (reg & B_BNC0){
-		start_signal(&s_bnc_0,  app_regs.REG_BNC0_ON,app_regs.REG_BNC0_PULSES, app_regs.REG_BNC0_OFF, app_regs.REG_BNC0_TAIL);
-		pulse_countdown.tail_bnc0 = app_regs.REG_BNC0_TAIL + 1;			// discard first count (callback reasons)
-		pulse_countdown.period_bnc0 =app_regs.REG_BNC0_ON + app_regs.REG_BNC0_OFF  ;			// discard first count (callback reasons)
-		pulse_countdown.t_bnc0 = app_regs.REG_BNC0_ON ;				// discard first count (callback reasons)
-		pulse_countdown.count_pulses_bnc0 = app_regs.REG_BNC0_PULSES + 1; // if 0 -> infinite pulses		
-		
-		if((pulse_countdown.tail_bnc0 == 1) && (app_regs.REG_BNC0_ON != 0))
-			set_BNC_SIG1_O;
-			
-	} 
-	else clr_BNC_SIG1_O;
-	
-//BNC1	
-	if (reg & B_BNC1){
-		start_signal(&s_bnc_1,  app_regs.REG_BNC1_ON,app_regs.REG_BNC1_PULSES, app_regs.REG_BNC1_OFF, app_regs.REG_BNC1_TAIL);
-		pulse_countdown.tail_bnc1 = app_regs.REG_BNC1_TAIL + 1;			// discard first count (callback reasons)
-		pulse_countdown.period_bnc1 =app_regs.REG_BNC1_ON + app_regs.REG_BNC1_OFF  ;			// discard first count (callback reasons)
-		pulse_countdown.t_bnc1 = app_regs.REG_BNC1_ON ;				// discard first count (callback reasons)
-		pulse_countdown.count_pulses_bnc1 = app_regs.REG_BNC1_PULSES + 1; // if 0 -> infinite pulses
-		
-		if((pulse_countdown.tail_bnc1 == 1) && (app_regs.REG_BNC1_ON != 0))
-			set_BNC_SIG2_O;
-	}
-	else clr_BNC_SIG2_O;
-
-
-
-
-
-
+	/* Nothing starts while the key is off */
+	if (reg && !read_ON_OFF_KEY)
+		return false;
 
+	/* Assigned first, the start event carries the new value */
 	app_regs.REG_BNCS_STATE = reg;
+	set_channels(((reg & B_BNC0) ? B_CH_BNC1 : 0) | ((reg & B_BNC1) ? B_CH_BNC2 : 0), B_CH_BNC1 | B_CH_BNC2);
+
 	return true;
 }
 
@@ -409,38 +504,15 @@ void app_read_REG_SIGNAL_STATE(void)
 bool app_write_REG_SIGNAL_STATE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
-	
-	
-//SIGNAL A
-
-	if (reg & B_SIGNAL_A){
-		start_signal(&s_signal_a,  app_regs.REG_SIGNAL_A_ON,app_regs.REG_SIGNAL_A_PULSES, app_regs.REG_SIGNAL_A_OFF, app_regs.REG_SIGNAL_A_TAIL);
-		pulse_countdown.tail_signal_a= app_regs.REG_SIGNAL_A_TAIL + 1;			// discard first count (callback reasons)
-		pulse_countdown.period_signal_a =app_regs.REG_SIGNAL_A_ON + app_regs.REG_SIGNAL_A_OFF  ;			// discard first count (callback reasons)
-		pulse_countdown.t_signal_a = app_regs.REG_SIGNAL_A_ON ;				// discard first count (callback reasons)
-		pulse_countdown.count_pulses_signal_a = app_regs.REG_SIGNAL_A_PULSES + 1; // if 0 -> infinite pulses
-	
-		if((pulse_countdown.tail_signal_a == 1) && (app_regs.REG_SIGNAL_A_ON != 0))
-		set_SIGNAL_A_O;
-	}
-	else clr_SIGNAL_A_O;
-
 
-//SIGNAL B
-
-	if (reg & B_SIGNAL_B){
-		start_signal(&s_signal_b,  app_regs.REG_SIGNAL_B_ON,app_regs.REG_SIGNAL_B_PULSES, app_regs.REG_SIGNAL_B_OFF, app_regs.REG_SIGNAL_B_TAIL);
-		pulse_countdown.tail_signal_b= app_regs.REG_SIGNAL_B_TAIL + 1;			// discard first count (callback reasons)
-		pulse_countdown.period_signal_b =app_regs.REG_SIGNAL_B_ON + app_regs.REG_SIGNAL_B_OFF  ;			// discard first count (callback reasons)
-		pulse_countdown.t_signal_b = app_regs.REG_SIGNAL_B_ON ;				// discard first count (callback reasons)
-		pulse_countdown.count_pulses_signal_b = app_regs.REG_SIGNAL_B_PULSES + 1; // if 0 -> infinite pulses
-		
-		if((pulse_countdown.tail_signal_b == 1) && (app_regs.REG_SIGNAL_B_ON != 0))
-		set_SIGNAL_B_O;
-	}
-	else clr_SIGNAL_B_O;
+	/* Nothing starts while the key is off */
+	if (reg && !read_ON_OFF_KEY)
+		return false;
 
+	/* Assigned first, the start event carries the new value */
 	app_regs.REG_SIGNAL_STATE = reg;
+	set_channels(((reg & B_SIGNAL_A) ? B_CH_SIGNAL_A : 0) | ((reg & B_SIGNAL_B) ? B_CH_SIGNAL_B : 0), B_CH_SIGNAL_A | B_CH_SIGNAL_B);
+
 	return true;
 }
 
@@ -459,6 +531,8 @@ bool app_write_REG_BNC0_ON(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_BNC0_ON = reg;
+	app_regs.REG_BNC0_ON_US = (uint32_t)reg * 1000;
+	reload_channel(CH_BNC1);
 	return true;
 }
 
@@ -477,6 +551,8 @@ bool app_write_REG_BNC0_OFF(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_BNC0_OFF = reg;
+	app_regs.REG_BNC0_OFF_US = (uint32_t)reg * 1000;
+	reload_channel(CH_BNC1);
 	return true;
 }
 
@@ -495,6 +571,7 @@ bool app_write_REG_BNC0_PULSES(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_BNC0_PULSES = reg;
+	reload_channel(CH_BNC1);
 	return true;
 }
 
@@ -513,6 +590,8 @@ bool app_write_REG_BNC0_TAIL(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_BNC0_TAIL = reg;
+	app_regs.REG_BNC0_TAIL_US = (uint32_t)reg * 1000;
+	reload_channel(CH_BNC1);
 	return true;
 }
 
@@ -531,6 +610,8 @@ bool app_write_REG_BNC1_ON(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_BNC1_ON = reg;
+	app_regs.REG_BNC1_ON_US = (uint32_t)reg * 1000;
+	reload_channel(CH_BNC2);
 	return true;
 }
 
@@ -549,6 +630,8 @@ bool app_write_REG_BNC1_OFF(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_BNC1_OFF = reg;
+	app_regs.REG_BNC1_OFF_US = (uint32_t)reg * 1000;
+	reload_channel(CH_BNC2);
 	return true;
 }
 
@@ -567,6 +650,7 @@ bool app_write_REG_BNC1_PULSES(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_BNC1_PULSES = reg;
+	reload_channel(CH_BNC2);
 	return true;
 }
 
@@ -585,6 +669,8 @@ bool app_write_REG_BNC1_TAIL(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_BNC1_TAIL = reg;
+	app_regs.REG_BNC1_TAIL_US = (uint32_t)reg * 1000;
+	reload_channel(CH_BNC2);
 	return true;
 }
 
@@ -603,6 +689,8 @@ bool app_write_REG_SIGNAL_A_ON(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_SIGNAL_A_ON = reg;
+	app_regs.REG_SIGNAL_A_ON_US = (uint32_t)reg * 1000;
+	reload_channel(CH_SIGNAL_A);
 	return true;
 }
 
@@ -621,6 +709,8 @@ bool app_write_REG_SIGNAL_A_OFF(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_SIGNAL_A_OFF = reg;
+	app_regs.REG_SIGNAL_A_OFF_US = (uint32_t)reg * 1000;
+	reload_channel(CH_SIGNAL_A);
 	return true;
 }
 
@@ -639,6 +729,7 @@ bool app_write_REG_SIGNAL_A_PULSES(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_SIGNAL_A_PULSES = reg;
+	reload_channel(CH_SIGNAL_A);
 	return true;
 }
 
@@ -657,6 +748,8 @@ bool app_write_REG_SIGNAL_A_TAIL(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_SIGNAL_A_TAIL = reg;
+	app_regs.REG_SIGNAL_A_TAIL_US = (uint32_t)reg * 1000;
+	reload_channel(CH_SIGNAL_A);
 	return true;
 }
 
@@ -675,6 +768,8 @@ bool app_write_REG_SIGNAL_B_ON(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_SIGNAL_B_ON = reg;
+	app_regs.REG_SIGNAL_B_ON_US = (uint32_t)reg * 1000;
+	reload_channel(CH_SIGNAL_B);
 	return true;
 }
 
@@ -693,6 +788,8 @@ bool app_write_REG_SIGNAL_B_OFF(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_SIGNAL_B_OFF = reg;
+	app_regs.REG_SIGNAL_B_OFF_US = (uint32_t)reg * 1000;
+	reload_channel(CH_SIGNAL_B);
 	return true;
 }
 
@@ -711,6 +808,7 @@ bool app_write_REG_SIGNAL_B_PULSES(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_SIGNAL_B_PULSES = reg;
+	reload_channel(CH_SIGNAL_B);
 	return true;
 }
 
@@ -729,6 +827,8 @@ bool app_write_REG_SIGNAL_B_TAIL(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_SIGNAL_B_TAIL = reg;
+	app_regs.REG_SIGNAL_B_TAIL_US = (uint32_t)reg * 1000;
+	reload_channel(CH_SIGNAL_B);
 	return true;
 }
 
@@ -751,16 +851,1212 @@ bool app_write_REG_EVNT_ENABLE(void *a)
 }
 
 
-void start_signal(interval_t *signal, uint16_t t_on_ms, uint16_t n_pulses, uint16_t t_off_ms, uint16_t t_tail_ms){
+/************************************************************************/
+/* REG_BNC0_ON_US                                                       */
+/************************************************************************/
+void app_read_REG_BNC0_ON_US(void)
+{
+	//app_regs.REG_BNC0_ON_US = 0;
 
-	signal->on_ms = t_on_ms;
-	signal->off_ms = t_off_ms;
-	signal->pulses = n_pulses;
-	signal->tail_ms = t_tail_ms;
-	
-	/*s_bnc_0.on_ms = t_on_ms;
-	s_bnc_0.off_ms = t_off_ms;
-	s_bnc_0.pulses = n_pulses;
-	s_bnc_0.tail_ms = t_tail_ms;*/
+}
+
+bool app_write_REG_BNC0_ON_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_BNC0_ON_US = reg;
+	app_regs.REG_BNC0_ON = reg / 1000;
+	reload_channel(CH_BNC1);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC0_OFF_US                                                      */
+/************************************************************************/
+void app_read_REG_BNC0_OFF_US(void)
+{
+	//app_regs.REG_BNC0_OFF_US = 0;
+
+}
+
+bool app_write_REG_BNC0_OFF_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_BNC0_OFF_US = reg;
+	app_regs.REG_BNC0_OFF = reg / 1000;
+	reload_channel(CH_BNC1);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC0_TAIL_US                                                     */
+/************************************************************************/
+void app_read_REG_BNC0_TAIL_US(void)
+{
+	//app_regs.REG_BNC0_TAIL_US = 0;
+
+}
+
+bool app_write_REG_BNC0_TAIL_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_BNC0_TAIL_US = reg;
+	app_regs.REG_BNC0_TAIL = reg / 1000;
+	reload_channel(CH_BNC1);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC1_ON_US                                                       */
+/************************************************************************/
+void app_read_REG_BNC1_ON_US(void)
+{
+	//app_regs.REG_BNC1_ON_US = 0;
+
+}
+
+bool app_write_REG_BNC1_ON_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_BNC1_ON_US = reg;
+	app_regs.REG_BNC1_ON = reg / 1000;
+	reload_channel(CH_BNC2);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC1_OFF_US                                                      */
+/************************************************************************/
+void app_read_REG_BNC1_OFF_US(void)
+{
+	//app_regs.REG_BNC1_OFF_US = 0;
+
+}
+
+bool app_write_REG_BNC1_OFF_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_BNC1_OFF_US = reg;
+	app_regs.REG_BNC1_OFF = reg / 1000;
+	reload_channel(CH_BNC2);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC1_TAIL_US                                                     */
+/************************************************************************/
+void app_read_REG_BNC1_TAIL_US(void)
+{
+	//app_regs.REG_BNC1_TAIL_US = 0;
+
+}
+
+bool app_write_REG_BNC1_TAIL_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_BNC1_TAIL_US = reg;
+	app_regs.REG_BNC1_TAIL = reg / 1000;
+	reload_channel(CH_BNC2);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_A_ON_US                                                   */
+/************************************************************************/
+void app_read_REG_SIGNAL_A_ON_US(void)
+{
+	//app_regs.REG_SIGNAL_A_ON_US = 0;
+
+}
+
+bool app_write_REG_SIGNAL_A_ON_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_SIGNAL_A_ON_US = reg;
+	app_regs.REG_SIGNAL_A_ON = reg / 1000;
+	reload_channel(CH_SIGNAL_A);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_A_OFF_US                                                  */
+/************************************************************************/
+void app_read_REG_SIGNAL_A_OFF_US(void)
+{
+	//app_regs.REG_SIGNAL_A_OFF_US = 0;
+
+}
+
+bool app_write_REG_SIGNAL_A_OFF_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_SIGNAL_A_OFF_US = reg;
+	app_regs.REG_SIGNAL_A_OFF = reg / 1000;
+	reload_channel(CH_SIGNAL_A);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_A_TAIL_US                                                 */
+/************************************************************************/
+void app_read_REG_SIGNAL_A_TAIL_US(void)
+{
+	//app_regs.REG_SIGNAL_A_TAIL_US = 0;
+
+}
+
+bool app_write_REG_SIGNAL_A_TAIL_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_SIGNAL_A_TAIL_US = reg;
+	app_regs.REG_SIGNAL_A_TAIL = reg / 1000;
+	reload_channel(CH_SIGNAL_A);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_B_ON_US                                                   */
+/************************************************************************/
+void app_read_REG_SIGNAL_B_ON_US(void)
+{
+	//app_regs.REG_SIGNAL_B_ON_US = 0;
+
+}
+
+bool app_write_REG_SIGNAL_B_ON_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_SIGNAL_B_ON_US = reg;
+	app_regs.REG_SIGNAL_B_ON = reg / 1000;
+	reload_channel(CH_SIGNAL_B);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_B_OFF_US                                                  */
+/************************************************************************/
+void app_read_REG_SIGNAL_B_OFF_US(void)
+{
+	//app_regs.REG_SIGNAL_B_OFF_US = 0;
+
+}
+
+bool app_write_REG_SIGNAL_B_OFF_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_SIGNAL_B_OFF_US = reg;
+	app_regs.REG_SIGNAL_B_OFF = reg / 1000;
+	reload_channel(CH_SIGNAL_B);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_B_TAIL_US                                                 */
+/************************************************************************/
+void app_read_REG_SIGNAL_B_TAIL_US(void)
+{
+	//app_regs.REG_SIGNAL_B_TAIL_US = 0;
+
+}
+
+bool app_write_REG_SIGNAL_B_TAIL_US(void *a)
+{
+	uint32_t reg = *((uint32_t*)a);
+
+	if (!pulse_time_us_is_valid(reg))
+		return false;
+
+	app_regs.REG_SIGNAL_B_TAIL_US = reg;
+	app_regs.REG_SIGNAL_B_TAIL = reg / 1000;
+	reload_channel(CH_SIGNAL_B);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC0_SEQUENCE                                                    */
+/************************************************************************/
+void app_read_REG_BNC0_SEQUENCE(void)
+{
+	//app_regs.REG_BNC0_SEQUENCE = 0;
+
+}
+
+bool app_write_REG_BNC0_SEQUENCE(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+
+	for (uint8_t i = 0; i < SEQ_LENGTH; i++)
+		if (!pulse_time_us_is_valid(reg[i] & SEQ_DURATION_MASK))
+			return false;
+
+	for (uint8_t i = 0; i < SEQ_LENGTH; i++)
+		app_regs.REG_BNC0_SEQUENCE[i] = reg[i];
+
+	update_first_high_pins(B_CH_BNC1);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC1_SEQUENCE                                                    */
+/************************************************************************/
+void app_read_REG_BNC1_SEQUENCE(void)
+{
+	//app_regs.REG_BNC1_SEQUENCE = 0;
+
+}
+
+bool app_write_REG_BNC1_SEQUENCE(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+
+	for (uint8_t i = 0; i < SEQ_LENGTH; i++)
+		if (!pulse_time_us_is_valid(reg[i] & SEQ_DURATION_MASK))
+			return false;
+
+	for (uint8_t i = 0; i < SEQ_LENGTH; i++)
+		app_regs.REG_BNC1_SEQUENCE[i] = reg[i];
+
+	update_first_high_pins(B_CH_BNC2);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_A_SEQUENCE                                                */
+/************************************************************************/
+void app_read_REG_SIGNAL_A_SEQUENCE(void)
+{
+	//app_regs.REG_SIGNAL_A_SEQUENCE = 0;
+
+}
+
+bool app_write_REG_SIGNAL_A_SEQUENCE(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+
+	for (uint8_t i = 0; i < SEQ_LENGTH; i++)
+		if (!pulse_time_us_is_valid(reg[i] & SEQ_DURATION_MASK))
+			return false;
+
+	for (uint8_t i = 0; i < SEQ_LENGTH; i++)
+		app_regs.REG_SIGNAL_A_SEQUENCE[i] = reg[i];
+
+	update_first_high_pins(B_CH_SIGNAL_A);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_B_SEQUENCE                                                */
+/************************************************************************/
+void app_read_REG_SIGNAL_B_SEQUENCE(void)
+{
+	//app_regs.REG_SIGNAL_B_SEQUENCE = 0;
+
+}
+
+bool app_write_REG_SIGNAL_B_SEQUENCE(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+
+	for (uint8_t i = 0; i < SEQ_LENGTH; i++)
+		if (!pulse_time_us_is_valid(reg[i] & SEQ_DURATION_MASK))
+			return false;
+
+	for (uint8_t i = 0; i < SEQ_LENGTH; i++)
+		app_regs.REG_SIGNAL_B_SEQUENCE[i] = reg[i];
+
+	update_first_high_pins(B_CH_SIGNAL_B);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_LOOPS                                                   */
+/************************************************************************/
+void app_read_REG_SEQUENCE_LOOPS(void)
+{
+	//app_regs.REG_SEQUENCE_LOOPS = 0;
+
+}
+
+bool app_write_REG_SEQUENCE_LOOPS(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_SEQUENCE_LOOPS[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_ENABLE                                                  */
+/************************************************************************/
+void app_read_REG_SEQUENCE_ENABLE(void)
+{
+	//app_regs.REG_SEQUENCE_ENABLE = 0;
+
+}
+
+bool app_write_REG_SEQUENCE_ENABLE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_SEQUENCE_ENABLE = reg & B_CH_ALL;
+
+	update_first_high_pins(B_CH_ALL);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PATTERN                                                          */
+/************************************************************************/
+void app_read_REG_PATTERN(void)
+{
+	//app_regs.REG_PATTERN = 0;
+
+}
+
+bool app_write_REG_PATTERN(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+
+	for (uint8_t i = 0; i < 128; i++)
+		app_regs.REG_PATTERN[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PATTERN_LENGTH                                                   */
+/************************************************************************/
+void app_read_REG_PATTERN_LENGTH(void)
+{
+	//app_regs.REG_PATTERN_LENGTH = 0;
+
+}
+
+bool app_write_REG_PATTERN_LENGTH(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg > PATTERN_MAX_LENGTH)
+		return false;
+
+	app_regs.REG_PATTERN_LENGTH = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PATTERN_SLOT                                                     */
+/************************************************************************/
+void app_read_REG_PATTERN_SLOT(void)
+{
+	//app_regs.REG_PATTERN_SLOT = 0;
+
+}
+
+bool app_write_REG_PATTERN_SLOT(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	if (reg < 1 || reg > PATTERN_MAX_SLOT_US)
+		return false;
+
+	app_regs.REG_PATTERN_SLOT = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PATTERN_LOOPS                                                    */
+/************************************************************************/
+void app_read_REG_PATTERN_LOOPS(void)
+{
+	//app_regs.REG_PATTERN_LOOPS = 0;
+
+}
+
+bool app_write_REG_PATTERN_LOOPS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_PATTERN_LOOPS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PATTERN_STATE                                                    */
+/************************************************************************/
+void app_read_REG_PATTERN_STATE(void)
+{
+	//app_regs.REG_PATTERN_STATE = 0;
+
+}
+
+bool app_write_REG_PATTERN_STATE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg)
+		return pattern_start();
+
+	pattern_stop();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHANNELS_STATE                                                   */
+/************************************************************************/
+void app_read_REG_CHANNELS_STATE(void)
+{
+	app_regs.REG_CHANNELS_STATE = pulse_running & B_CH_ALL;
+}
+
+bool app_write_REG_CHANNELS_STATE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a) & B_CH_ALL;
+
+	/* Nothing starts while the key is off */
+	if (reg && !read_ON_OFF_KEY)
+		return false;
+
+	/* Same bit order as the BNCs and Signals start registers */
+	app_regs.REG_BNCS_STATE = reg & (B_BNC0 | B_BNC1);
+	app_regs.REG_SIGNAL_STATE = (reg >> 2) & (B_SIGNAL_A | B_SIGNAL_B);
+
+	set_channels(reg, B_CH_ALL);
+
+	app_regs.REG_CHANNELS_STATE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TRIGGER_MODE                                                     */
+/************************************************************************/
+void app_read_REG_TRIGGER_MODE(void)
+{
+	//app_regs.REG_TRIGGER_MODE = 0;
+
+}
+
+bool app_write_REG_TRIGGER_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg > GM_TRIGGER_BOTH)
+		return false;
+
+	app_regs.REG_TRIGGER_MODE = reg;
+	trigger_config();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TRIGGER_CHANNELS                                                 */
+/************************************************************************/
+void app_read_REG_TRIGGER_CHANNELS(void)
+{
+	//app_regs.REG_TRIGGER_CHANNELS = 0;
+
+}
+
+bool app_write_REG_TRIGGER_CHANNELS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_TRIGGER_CHANNELS = reg & B_CH_ALL;
+	trigger_config();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_START_TIME                                                       */
+/************************************************************************/
+void app_read_REG_START_TIME(void)
+{
+	//app_regs.REG_START_TIME = 0;
+
+}
+
+bool app_write_REG_START_TIME(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+
+	if (reg[1] > 999999)
+		return false;
+
+	app_regs.REG_START_TIME[0] = reg[0];
+	app_regs.REG_START_TIME[1] = reg[1];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_START_TIME_CHANNELS                                              */
+/************************************************************************/
+void app_read_REG_START_TIME_CHANNELS(void)
+{
+	//app_regs.REG_START_TIME_CHANNELS = 0;
+
+}
+
+bool app_write_REG_START_TIME_CHANNELS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	return scheduled_start_arm(reg & B_CH_ALL);
+}
+
+
+/************************************************************************/
+/* REG_INTENSITY_SEQUENCE                                               */
+/************************************************************************/
+void app_read_REG_INTENSITY_SEQUENCE(void)
+{
+	//app_regs.REG_INTENSITY_SEQUENCE = 0;
+
+}
+
+bool app_write_REG_INTENSITY_SEQUENCE(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+
+	for (uint8_t i = 0; i < 128; i++)
+		app_regs.REG_INTENSITY_SEQUENCE[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INTENSITY_SEQUENCE_LENGTH                                        */
+/************************************************************************/
+void app_read_REG_INTENSITY_SEQUENCE_LENGTH(void)
+{
+	//app_regs.REG_INTENSITY_SEQUENCE_LENGTH = 0;
+
+}
+
+bool app_write_REG_INTENSITY_SEQUENCE_LENGTH(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg > INTENSITY_SEQUENCE_MAX_LENGTH)
+		return false;
+
+	app_regs.REG_INTENSITY_SEQUENCE_LENGTH = reg;
+	intensity_sequence_stop();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INTENSITY_SEQUENCE_CHANNEL                                       */
+/************************************************************************/
+void app_read_REG_INTENSITY_SEQUENCE_CHANNEL(void)
+{
+	//app_regs.REG_INTENSITY_SEQUENCE_CHANNEL = 0;
+
+}
+
+bool app_write_REG_INTENSITY_SEQUENCE_CHANNEL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if ((reg & ~B_CH_ALL) || (reg & (reg - 1)))
+		return false;
+
+	app_regs.REG_INTENSITY_SEQUENCE_CHANNEL = reg;
+	intensity_sequence_stop();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INTENSITY_LUT_LOW                                                */
+/************************************************************************/
+void app_read_REG_INTENSITY_LUT_LOW(void)
+{
+	//app_regs.REG_INTENSITY_LUT_LOW = 0;
+
+}
+
+bool app_write_REG_INTENSITY_LUT_LOW(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+
+	for (uint8_t i = 0; i < 128; i++)
+		app_regs.REG_INTENSITY_LUT_LOW[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INTENSITY_LUT_HIGH                                               */
+/************************************************************************/
+void app_read_REG_INTENSITY_LUT_HIGH(void)
+{
+	//app_regs.REG_INTENSITY_LUT_HIGH = 0;
+
+}
+
+bool app_write_REG_INTENSITY_LUT_HIGH(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+
+	for (uint8_t i = 0; i < 128; i++)
+		app_regs.REG_INTENSITY_LUT_HIGH[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LASER_POWER                                                      */
+/************************************************************************/
+void app_read_REG_LASER_POWER(void)
+{
+	//app_regs.REG_LASER_POWER = 0;
+
+}
+
+bool app_write_REG_LASER_POWER(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	uint8_t intensity = (reg < 128) ? app_regs.REG_INTENSITY_LUT_LOW[reg] : app_regs.REG_INTENSITY_LUT_HIGH[reg - 128];
+
+	if (intensity && !read_ON_OFF_KEY)
+		return false;
+
+	app_regs.REG_LASER_POWER = reg;
+	app_regs.REG_LASER_INTENSITY = intensity;
+	digipot_write(app_regs.REG_LASER_INTENSITY);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC0_CONFIG                                                      */
+/************************************************************************/
+void app_read_REG_BNC0_CONFIG(void)
+{
+	//app_regs.REG_BNC0_CONFIG[0] = 0;
+
+}
+
+bool app_write_REG_BNC0_CONFIG(void *a)
+{
+	write_channel_config(CH_BNC1, (uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_BNC1_CONFIG                                                      */
+/************************************************************************/
+void app_read_REG_BNC1_CONFIG(void)
+{
+	//app_regs.REG_BNC1_CONFIG[0] = 0;
+
+}
+
+bool app_write_REG_BNC1_CONFIG(void *a)
+{
+	write_channel_config(CH_BNC2, (uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_A_CONFIG                                                  */
+/************************************************************************/
+void app_read_REG_SIGNAL_A_CONFIG(void)
+{
+	//app_regs.REG_SIGNAL_A_CONFIG[0] = 0;
+
+}
+
+bool app_write_REG_SIGNAL_A_CONFIG(void *a)
+{
+	write_channel_config(CH_SIGNAL_A, (uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SIGNAL_B_CONFIG                                                  */
+/************************************************************************/
+void app_read_REG_SIGNAL_B_CONFIG(void)
+{
+	//app_regs.REG_SIGNAL_B_CONFIG[0] = 0;
+
+}
+
+bool app_write_REG_SIGNAL_B_CONFIG(void *a)
+{
+	write_channel_config(CH_SIGNAL_B, (uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHANNELS_CONFIG                                                  */
+/************************************************************************/
+void app_read_REG_CHANNELS_CONFIG(void)
+{
+	//app_regs.REG_CHANNELS_CONFIG[0] = 0;
+
+}
+
+bool app_write_REG_CHANNELS_CONFIG(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+
+	for (uint8_t ch = 0; ch < PULSE_CHANNELS; ch++)
+		if (channels[ch].timing_us)
+			write_channel_config(ch, reg + ch * 4);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TIMING_UPDATE_MODE                                               */
+/************************************************************************/
+void app_read_REG_TIMING_UPDATE_MODE(void)
+{
+	//app_regs.REG_TIMING_UPDATE_MODE = 0;
+
+}
+
+bool app_write_REG_TIMING_UPDATE_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg > GM_TIMING_STAGED)
+		return false;
+
+	/* Times still staged are applied when going back to immediate */
+	if (reg == GM_TIMING_IMMEDIATE && app_regs.REG_TIMING_UPDATE_MODE == GM_TIMING_STAGED)
+		commit_channels(B_CH_ALL);
+
+	app_regs.REG_TIMING_UPDATE_MODE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TIMING_COMMIT                                                    */
+/************************************************************************/
+void app_read_REG_TIMING_COMMIT(void)
+{
+	//app_regs.REG_TIMING_COMMIT = 0;
+
+}
+
+bool app_write_REG_TIMING_COMMIT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg & ~B_CH_ALL)
+		return false;
+
+	commit_channels(reg);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SPAD_SWITCH_DEBOUNCE                                             */
+/************************************************************************/
+void app_read_REG_SPAD_SWITCH_DEBOUNCE(void)
+{
+	//app_regs.REG_SPAD_SWITCH_DEBOUNCE = 0;
+
+}
+
+bool app_write_REG_SPAD_SWITCH_DEBOUNCE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_SPAD_SWITCH_DEBOUNCE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LASER_STATE_DEBOUNCE                                             */
+/************************************************************************/
+void app_read_REG_LASER_STATE_DEBOUNCE(void)
+{
+	//app_regs.REG_LASER_STATE_DEBOUNCE = 0;
+
+}
+
+bool app_write_REG_LASER_STATE_DEBOUNCE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_LASER_STATE_DEBOUNCE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INTERLOCK_LATENCY                                                */
+/************************************************************************/
+void app_read_REG_INTERLOCK_LATENCY(void)
+{
+	//app_regs.REG_INTERLOCK_LATENCY = 0;
+
+}
+
+bool app_write_REG_INTERLOCK_LATENCY(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_DIAGNOSTICS                                                      */
+/************************************************************************/
+void app_read_REG_DIAGNOSTICS(void)
+{
+	//app_regs.REG_DIAGNOSTICS = 0;
+
+}
+
+bool app_write_REG_DIAGNOSTICS(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_DIAGNOSTICS_RESET                                                */
+/************************************************************************/
+void app_read_REG_DIAGNOSTICS_RESET(void)
+{
+	//app_regs.REG_DIAGNOSTICS_RESET = 0;
+
+}
+
+bool app_write_REG_DIAGNOSTICS_RESET(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg & 1)
+		diag_reset();
+	if (reg & 2)
+		latency_reset();
+	if (reg & 4)
+		uart_tx_stats_reset();
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LATENCY_HISTOGRAM                                                */
+/************************************************************************/
+void app_read_REG_LATENCY_HISTOGRAM(void)
+{
+	//app_regs.REG_LATENCY_HISTOGRAM = 0;
+
+}
+
+bool app_write_REG_LATENCY_HISTOGRAM(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_UART_TX_STATS                                                    */
+/************************************************************************/
+void app_read_REG_UART_TX_STATS(void)
+{
+	app_regs.REG_UART_TX_STATS[0] = uart_tx_fill();
+}
+
+bool app_write_REG_UART_TX_STATS(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_EDGE_EVENTS                                                      */
+/************************************************************************/
+void app_read_REG_EDGE_EVENTS(void)
+{
+	//app_regs.REG_EDGE_EVENTS = 0;
+
+}
+
+bool app_write_REG_EDGE_EVENTS(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_EDGE_EVENTS_CHANNELS                                             */
+/************************************************************************/
+void app_read_REG_EDGE_EVENTS_CHANNELS(void)
+{
+	//app_regs.REG_EDGE_EVENTS_CHANNELS = 0;
+
+}
+
+bool app_write_REG_EDGE_EVENTS_CHANNELS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg & ~B_CH_ALL)
+		return false;
+
+	app_regs.REG_EDGE_EVENTS_CHANNELS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EDGE_EVENTS_LATENCY                                              */
+/************************************************************************/
+void app_read_REG_EDGE_EVENTS_LATENCY(void)
+{
+	//app_regs.REG_EDGE_EVENTS_LATENCY = 0;
+
+}
+
+bool app_write_REG_EDGE_EVENTS_LATENCY(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg < 1)
+		return false;
+
+	app_regs.REG_EDGE_EVENTS_LATENCY = reg;
+	return true;
+}
+
+
+void start_signal(interval_t *signal, uint32_t t_on_us, uint16_t n_pulses, uint32_t t_off_us, uint32_t t_tail_us){
+
+	signal->on_us = t_on_us;
+	signal->off_us = t_off_us;
+	signal->pulses = n_pulses;
+	signal->tail_us = t_tail_us;
+}
+
+/* Latches the timings of the channels in mask from their bank */
+void load_channels(uint8_t mask){
+
+	for (uint8_t ch = 0; ch < PULSE_CHANNELS; ch++){
+		channel_t *c = &channels[ch];
+		uint16_t pulses;
+
+		if (!(mask & (1 << ch)) || c->timing_us == 0)
+			continue;
+
+		c->play_sequence = (app_regs.REG_SEQUENCE_ENABLE & (1 << ch)) != 0;
+		pulses = c->play_sequence ? app_regs.REG_SEQUENCE_LOOPS[ch] : c->bank.pulses;
+
+		start_signal(&c->cfg, c->bank.on_us, pulses, c->bank.off_us, c->bank.tail_us);
+	}
+
+	update_first_high_pins(mask);
+}
+
+/* Finds the outputs that go high as soon as the channels in mask       */
+/* start, from their bank and sequence. Running trains are untouched.   */
+void update_first_high_pins(uint8_t mask){
+
+	uint8_t sreg = SREG;
+
+	/* The trigger interrupt reads them and loads channels too */
+	cli();
+
+	for (uint8_t ch = 0; ch < PULSE_CHANNELS; ch++){
+		channel_t *c = &channels[ch];
+		bool first_high;
+
+		if (!(mask & (1 << ch)) || c->timing_us == 0)
+			continue;
+
+		if (app_regs.REG_SEQUENCE_ENABLE & (1 << ch))
+			first_high = (c->sequence[0] & SEQ_LEVEL_bm) && (c->sequence[0] & SEQ_DURATION_MASK);
+		else
+			first_high = (c->bank.on_us != 0) && (c->bank.tail_us == 0);
+
+		pulse_first_high_pins &= ~c->pin_mask;
+		if (first_high)
+			pulse_first_high_pins |= c->pin_mask;
+	}
+
+	SREG = sreg;
+}
+
+/* Starts the channels in start_mask from the same timer tick and stops */
+/* the other channels of affected_mask */
+void set_channels(uint8_t start_mask, uint8_t affected_mask){
+
+	uint32_t t0;
+
+	if (start_mask && app_regs.REG_PATTERN_STATE)
+		pattern_stop();
+
+	load_channels(start_mask);
+
+	pulse_channels_stop(affected_mask & ~start_mask);
+
+	t0 = pulse_time_now();
+	pulse_channels_start_at(start_mask, t0);
+
+	if (start_mask & pulse_running)
+		latency_effect_at(LATENCY_EDGE, t0);
+}
+
+/* Copies the timing registers of a channel to the bank starts read     */
+/* from, in staged mode it only changes on a commit.                    */
+static void bank_channel(uint8_t ch){
+
+	channel_t *c = &channels[ch];
+
+	c->bank.on_us = c->timing_us[0];
+	c->bank.off_us = c->timing_us[1];
+	c->bank.tail_us = c->timing_us[2];
+	c->bank.pulses = *c->pulses;
+}
+
+/* Hands the banked ON and OFF times over to a running train, which     */
+/* takes them at its next pulse. PULSES and TAIL are only used by the   */
+/* next start.                                                          */
+static void stage_channel(uint8_t ch){
+
+	channel_t *c = &channels[ch];
+	uint8_t sreg = SREG;
+
+	if (!(pulse_running & (1 << ch)) || c->play_sequence || c->bank.on_us == 0)
+		return;
+
+	/* The engine never sees half of the new times */
+	cli();
+	c->next_on_us = c->bank.on_us;
+	c->next_off_us = c->bank.off_us;
+	c->reload = true;
+	SREG = sreg;
+}
+
+/* Called when a timing register changes */
+void reload_channel(uint8_t ch){
+
+	if (app_regs.REG_TIMING_UPDATE_MODE == GM_TIMING_STAGED)
+		return;
+
+	commit_channels(1 << ch);
+}
+
+/* Applies the registers to all the channels in 'mask' at once */
+void commit_channels(uint8_t mask){
+
+	uint8_t sreg = SREG;
+
+	cli();
+
+	for (uint8_t ch = 0; ch < PULSE_CHANNELS; ch++){
+		if (!(mask & (1 << ch)) || channels[ch].timing_us == 0)
+			continue;
+
+		bank_channel(ch);
+		stage_channel(ch);
+	}
+
+	update_first_high_pins(mask);
+	SREG = sreg;
+}
+
+/* Writes ON, OFF, PULSES and TAIL of a channel at once. A running     */
+/* train reloads a single time, so it never mixes old and new times.   */
+void write_channel_config(uint8_t ch, uint16_t *cfg){
+
+	uint16_t *ms = &app_regs.REG_BNC0_ON + ch * 4;
+	uint32_t *us = channels[ch].timing_us;
+
+	for (uint8_t i = 0; i < 4; i++)
+		ms[i] = cfg[i];
+
+	us[0] = (uint32_t)cfg[0] * 1000;
+	us[1] = (uint32_t)cfg[1] * 1000;
+	us[2] = (uint32_t)cfg[3] * 1000;
+	reload_channel(ch);
+}
+
+/* 0 disables the interval, anything else must be reachable by the pulse engine */
+bool pulse_time_us_is_valid(uint32_t us){
 
+	return (us == 0) || ((us >= PULSE_US_MIN) && (us <= PULSE_US_MAX));
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef _APP_FUNCTIONS_H_
 #define _APP_FUNCTIONS_H_
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 
 /************************************************************************/
 /* Define if not defined                                                */
@@ -15,6 +16,8 @@
 #define false 0
 #endif
 
+#include "structs.h"
+
 
 
 
@@ -52,6 +55,57 @@ void app_read_REG_SIGNAL_B_OFF(void);
 void app_read_REG_SIGNAL_B_PULSES(void);
 void app_read_REG_SIGNAL_B_TAIL(void);
 void app_read_REG_EVNT_ENABLE(void);
+void app_read_REG_BNC0_ON_US(void);
+void app_read_REG_BNC0_OFF_US(void);
+void app_read_REG_BNC0_TAIL_US(void);
+void app_read_REG_BNC1_ON_US(void);
+void app_read_REG_BNC1_OFF_US(void);
+void app_read_REG_BNC1_TAIL_US(void);
+void app_read_REG_SIGNAL_A_ON_US(void);
+void app_read_REG_SIGNAL_A_OFF_US(void);
+void app_read_REG_SIGNAL_A_TAIL_US(void);
+void app_read_REG_SIGNAL_B_ON_US(void);
+void app_read_REG_SIGNAL_B_OFF_US(void);
+void app_read_REG_SIGNAL_B_TAIL_US(void);
+void app_read_REG_BNC0_SEQUENCE(void);
+void app_read_REG_BNC1_SEQUENCE(void);
+void app_read_REG_SIGNAL_A_SEQUENCE(void);
+void app_read_REG_SIGNAL_B_SEQUENCE(void);
+void app_read_REG_SEQUENCE_LOOPS(void);
+void app_read_REG_SEQUENCE_ENABLE(void);
+void app_read_REG_PATTERN(void);
+void app_read_REG_PATTERN_LENGTH(void);
+void app_read_REG_PATTERN_SLOT(void);
+void app_read_REG_PATTERN_LOOPS(void);
+void app_read_REG_PATTERN_STATE(void);
+void app_read_REG_CHANNELS_STATE(void);
+void app_read_REG_TRIGGER_MODE(void);
+void app_read_REG_TRIGGER_CHANNELS(void);
+void app_read_REG_START_TIME(void);
+void app_read_REG_START_TIME_CHANNELS(void);
+void app_read_REG_INTENSITY_SEQUENCE(void);
+void app_read_REG_INTENSITY_SEQUENCE_LENGTH(void);
+void app_read_REG_INTENSITY_SEQUENCE_CHANNEL(void);
+void app_read_REG_INTENSITY_LUT_LOW(void);
+void app_read_REG_INTENSITY_LUT_HIGH(void);
+void app_read_REG_LASER_POWER(void);
+void app_read_REG_BNC0_CONFIG(void);
+void app_read_REG_BNC1_CONFIG(void);
+void app_read_REG_SIGNAL_A_CONFIG(void);
+void app_read_REG_SIGNAL_B_CONFIG(void);
+void app_read_REG_CHANNELS_CONFIG(void);
+void app_read_REG_TIMING_UPDATE_MODE(void);
+void app_read_REG_TIMING_COMMIT(void);
+void app_read_REG_SPAD_SWITCH_DEBOUNCE(void);
+void app_read_REG_LASER_STATE_DEBOUNCE(void);
+void app_read_REG_INTERLOCK_LATENCY(void);
+void app_read_REG_DIAGNOSTICS(void);
+void app_read_REG_DIAGNOSTICS_RESET(void);
+void app_read_REG_LATENCY_HISTOGRAM(void);
+void app_read_REG_UART_TX_STATS(void);
+void app_read_REG_EDGE_EVENTS(void);
+void app_read_REG_EDGE_EVENTS_CHANNELS(void);
+void app_read_REG_EDGE_EVENTS_LATENCY(void);
 
 bool app_write_REG_SPAD_SWITCH(void *a);
 bool app_write_REG_LASER_STATE(void *a);
@@ -84,12 +138,209 @@ bool app_write_REG_SIGNAL_B_OFF(void *a);
 bool app_write_REG_SIGNAL_B_PULSES(void *a);
 bool app_write_REG_SIGNAL_B_TAIL(void *a);
 bool app_write_REG_EVNT_ENABLE(void *a);
+bool app_write_REG_BNC0_ON_US(void *a);
+bool app_write_REG_BNC0_OFF_US(void *a);
+bool app_write_REG_BNC0_TAIL_US(void *a);
+bool app_write_REG_BNC1_ON_US(void *a);
+bool app_write_REG_BNC1_OFF_US(void *a);
+bool app_write_REG_BNC1_TAIL_US(void *a);
+bool app_write_REG_SIGNAL_A_ON_US(void *a);
+bool app_write_REG_SIGNAL_A_OFF_US(void *a);
+bool app_write_REG_SIGNAL_A_TAIL_US(void *a);
+bool app_write_REG_SIGNAL_B_ON_US(void *a);
+bool app_write_REG_SIGNAL_B_OFF_US(void *a);
+bool app_write_REG_SIGNAL_B_TAIL_US(void *a);
+bool app_write_REG_BNC0_SEQUENCE(void *a);
+bool app_write_REG_BNC1_SEQUENCE(void *a);
+bool app_write_REG_SIGNAL_A_SEQUENCE(void *a);
+bool app_write_REG_SIGNAL_B_SEQUENCE(void *a);
+bool app_write_REG_SEQUENCE_LOOPS(void *a);
+bool app_write_REG_SEQUENCE_ENABLE(void *a);
+bool app_write_REG_PATTERN(void *a);
+bool app_write_REG_PATTERN_LENGTH(void *a);
+bool app_write_REG_PATTERN_SLOT(void *a);
+bool app_write_REG_PATTERN_LOOPS(void *a);
+bool app_write_REG_PATTERN_STATE(void *a);
+bool app_write_REG_CHANNELS_STATE(void *a);
+bool app_write_REG_TRIGGER_MODE(void *a);
+bool app_write_REG_TRIGGER_CHANNELS(void *a);
+bool app_write_REG_START_TIME(void *a);
+bool app_write_REG_START_TIME_CHANNELS(void *a);
+bool app_write_REG_INTENSITY_SEQUENCE(void *a);
+bool app_write_REG_INTENSITY_SEQUENCE_LENGTH(void *a);
+bool app_write_REG_INTENSITY_SEQUENCE_CHANNEL(void *a);
+bool app_write_REG_INTENSITY_LUT_LOW(void *a);
+bool app_write_REG_INTENSITY_LUT_HIGH(void *a);
+bool app_write_REG_LASER_POWER(void *a);
+bool app_write_REG_BNC0_CONFIG(void *a);
+bool app_write_REG_BNC1_CONFIG(void *a);
+bool app_write_REG_SIGNAL_A_CONFIG(void *a);
+bool app_write_REG_SIGNAL_B_CONFIG(void *a);
+bool app_write_REG_CHANNELS_CONFIG(void *a);
+bool app_write_REG_TIMING_UPDATE_MODE(void *a);
+bool app_write_REG_TIMING_COMMIT(void *a);
+bool app_write_REG_SPAD_SWITCH_DEBOUNCE(void *a);
+bool app_write_REG_LASER_STATE_DEBOUNCE(void *a);
+bool app_write_REG_INTERLOCK_LATENCY(void *a);
+bool app_write_REG_DIAGNOSTICS(void *a);
+bool app_write_REG_DIAGNOSTICS_RESET(void *a);
+bool app_write_REG_LATENCY_HISTOGRAM(void *a);
+bool app_write_REG_UART_TX_STATS(void *a);
+bool app_write_REG_EDGE_EVENTS(void *a);
+bool app_write_REG_EDGE_EVENTS_CHANNELS(void *a);
+bool app_write_REG_EDGE_EVENTS_LATENCY(void *a);
 
 
 
 
-void update_digipot(uint8_t data, SPI_t* spi, PORT_t* cs_port, uint8_t cs_pin, PORT_t* spi_port);
+void digipot_init(void);
+void digipot_write(uint8_t data);
+void digipot_spi_done(void);
 void spad_switch_events(uint8_t state);
 void set_laser_freq(uint8_t value);
 
+/************************************************************************/
+/* Pulse engine                                                         */
+/************************************************************************/
+#define PULSE_TICKS_PER_US 4UL		// TCD0 clocked at 32 MHz / 8
+#define PULSE_US_MIN 10UL			// shortest interval of a train
+#define PULSE_US_MAX 65535000UL		// longest interval, same as the millisecond registers
+
+#define SEQ_LENGTH 32					// segments of the *_SEQUENCE registers
+#define SEQ_LEVEL_bm (1UL<<31)
+#define SEQ_DURATION_MASK 0x7FFFFFFFUL
+#define PULSE_MIN_LEAD_TICKS 16		// edges closer than this are not left to the compare
+
+/* One channel per BNC and Signal output. The engine loops over the     */
+/* table, but the timing registers and the channel masks of the start   */
+/* registers only cover these four, so DO1 and DO2 can't run trains.    */
+#define PULSE_CHANNELS 4
+
+#define CH_BNC1		0
+#define CH_BNC2		1
+#define CH_SIGNAL_A	2
+#define CH_SIGNAL_B	3
+
+void pulse_timer_init(void);
+uint32_t pulse_time_now(void);
+void pulse_schedule(void);
+uint8_t channels_to_pins(uint8_t mask);
+void pulse_channels_start_at(uint8_t mask, uint32_t t0);
+void pulse_channels_start(uint8_t mask);
+void pulse_channels_stop(uint8_t mask);
+void load_channels(uint8_t mask);
+void update_first_high_pins(uint8_t mask);
+void commit_channels(uint8_t mask);
+
+/************************************************************************/
+/* Pattern output                                                       */
+/************************************************************************/
+#define PATTERN_MAX_LENGTH 128		// slots of the PATTERN register
+#define PATTERN_MAX_SLOT_US 2000	// TCC0 runs at 32 MHz
+
+bool pattern_start(void);
+void pattern_stop(void);
+
+/************************************************************************/
+/* Trigger input                                                        */
+/************************************************************************/
+void trigger_config(void);
+void trigger_fire(void);
+
+/************************************************************************/
+/* Scheduled start                                                      */
+/************************************************************************/
+void scheduled_start_init(void);
+void scheduled_start_new_second(void);
+bool scheduled_start_arm(uint8_t mask);
+void scheduled_start_poll(void);
+
+/************************************************************************/
+/* Intensity sequence                                                   */
+/************************************************************************/
+#define INTENSITY_SEQUENCE_MAX_LENGTH 128	// values of the INTENSITY_SEQUENCE register
+#define INTENSITY_CHANNEL_NONE 0xFF
+
+void intensity_sequence_start(uint8_t mask);
+void intensity_sequence_step(void);
+void intensity_sequence_stop(void);
+
+/************************************************************************/
+/* Input edges                                                          */
+/************************************************************************/
+#define INPUT_EDGES_SIZE 16		// power of 2
+#define INPUT_SWITCH_5V 0
+#define INPUT_ON_OFF_KEY 1
+
+void input_debounce_init(void);
+void input_edge_detected(uint8_t input);
+void input_debounce_done(uint8_t input);
+void input_edges_drain(void);
+
+/************************************************************************/
+/* Interlock                                                            */
+/************************************************************************/
+void interlock_init(void);
+void interlock_fire(void);
+
+/************************************************************************/
+/* Diagnostics                                                          */
+/************************************************************************/
+#define DIAG_T_500US		0	// core_callback_t_500us
+#define DIAG_T_1MS			1	// core_callback_t_1ms
+#define DIAG_PULSE_EDGES	2	// pulse engine compare interrupts
+#define DIAG_DIGIPOT		3	// digipot_write
+#define DIAG_REG_WRITE		4	// register write handlers
+#define DIAG_PATHS			5
+
+void diag_init(void);
+void diag_reset(void);
+uint16_t diag_now(void);
+void diag_end(uint8_t path, uint16_t start);
+
+/************************************************************************/
+/* Write latency                                                        */
+/************************************************************************/
+#define LATENCY_BINS 32
+#define LATENCY_NONE 0
+#define LATENCY_DIGIPOT 1		// ends when the digipot latches the word
+#define LATENCY_OUTPUT 2		// ends when the write handler returns
+#define LATENCY_EDGE 3			// ends at the start time of the trains started by the write
+
+void latency_reset(void);
+void latency_write_start(uint8_t add, uint32_t entry);
+void latency_effect(uint8_t kind);
+void latency_effect_at(uint8_t kind, uint32_t ticks);
+void latency_write_end(bool ok);
+
+/************************************************************************/
+/* Event output                                                         */
+/************************************************************************/
+#define EVENT_OVERHEAD 12		// header, timestamp and checksum bytes of a Harp message
+
+void uart_tx_stats_reset(void);
+uint16_t uart_tx_fill(void);
+bool app_send_event(uint8_t add, bool use_core_timestamp);
+bool app_send_event_u8(uint8_t add, uint8_t value, bool use_core_timestamp);
+void uart_cts_changed(void);
+
+/************************************************************************/
+/* Edge events                                                          */
+/************************************************************************/
+#define PULSE_EDGES_SIZE 32				// power of 2
+#define EDGE_EVENTS_LENGTH 16			// entries of the EDGE_EVENTS register
+#define EDGE_EVENT_EMPTY 0xFFFFFFFFUL
+#define EDGE_EVENT_OFFSET_MASK 0x0FFFFFFFUL
+
+void edge_event_push(uint8_t ch, bool rising, uint32_t ticks);
+void edge_events_poll(void);
+
+/************************************************************************/
+/* State events                                                         */
+/************************************************************************/
+#define STATE_CHANGES_SIZE 8		// power of 2
+
+void state_change_push(uint8_t mask, uint32_t ticks);
+void state_changes_drain(void);
+
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
@@ -13,6 +13,7 @@ void init_ios(void)
 
 	/* Configure input interrupts */
 	io_set_int(&PORTH, INT_LEVEL_LOW, 0, (1<<0), false);                 // ON_OFF_KEY
+	io_set_int(&PORTH, INT_LEVEL_HIGH, 1, (1<<0), false);                // ON_OFF_KEY interlock
 	io_set_int(&PORTE, INT_LEVEL_LOW, 0, (1<<0), false);                 // SWITCH_5V
 
 	/* Configure output pins */
@@ -82,6 +83,57 @@ uint8_t app_regs_type[] = {
 	TYPE_U16,
 	TYPE_U16,
 	TYPE_U16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U8,
 	TYPE_U8
 };
 
@@ -116,6 +168,57 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	32,
+	32,
+	32,
+	32,
+	4,
+	1,
+	128,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	1,
+	128,
+	1,
+	1,
+	128,
+	128,
+	1,
+	4,
+	4,
+	4,
+	4,
+	16,
+	1,
+	1,
+	1,
+	1,
+	1,
+	15,
+	1,
+	32,
+	4,
+	16,
+	1,
 	1
 };
 
@@ -150,5 +253,56 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_SIGNAL_B_OFF),
 	(uint8_t*)(&app_regs.REG_SIGNAL_B_PULSES),
 	(uint8_t*)(&app_regs.REG_SIGNAL_B_TAIL),
-	(uint8_t*)(&app_regs.REG_EVNT_ENABLE)
+	(uint8_t*)(&app_regs.REG_EVNT_ENABLE),
+	(uint8_t*)(&app_regs.REG_BNC0_ON_US),
+	(uint8_t*)(&app_regs.REG_BNC0_OFF_US),
+	(uint8_t*)(&app_regs.REG_BNC0_TAIL_US),
+	(uint8_t*)(&app_regs.REG_BNC1_ON_US),
+	(uint8_t*)(&app_regs.REG_BNC1_OFF_US),
+	(uint8_t*)(&app_regs.REG_BNC1_TAIL_US),
+	(uint8_t*)(&app_regs.REG_SIGNAL_A_ON_US),
+	(uint8_t*)(&app_regs.REG_SIGNAL_A_OFF_US),
+	(uint8_t*)(&app_regs.REG_SIGNAL_A_TAIL_US),
+	(uint8_t*)(&app_regs.REG_SIGNAL_B_ON_US),
+	(uint8_t*)(&app_regs.REG_SIGNAL_B_OFF_US),
+	(uint8_t*)(&app_regs.REG_SIGNAL_B_TAIL_US),
+	(uint8_t*)(app_regs.REG_BNC0_SEQUENCE),
+	(uint8_t*)(app_regs.REG_BNC1_SEQUENCE),
+	(uint8_t*)(app_regs.REG_SIGNAL_A_SEQUENCE),
+	(uint8_t*)(app_regs.REG_SIGNAL_B_SEQUENCE),
+	(uint8_t*)(app_regs.REG_SEQUENCE_LOOPS),
+	(uint8_t*)(&app_regs.REG_SEQUENCE_ENABLE),
+	(uint8_t*)(app_regs.REG_PATTERN),
+	(uint8_t*)(&app_regs.REG_PATTERN_LENGTH),
+	(uint8_t*)(&app_regs.REG_PATTERN_SLOT),
+	(uint8_t*)(&app_regs.REG_PATTERN_LOOPS),
+	(uint8_t*)(&app_regs.REG_PATTERN_STATE),
+	(uint8_t*)(&app_regs.REG_CHANNELS_STATE),
+	(uint8_t*)(&app_regs.REG_TRIGGER_MODE),
+	(uint8_t*)(&app_regs.REG_TRIGGER_CHANNELS),
+	(uint8_t*)(app_regs.REG_START_TIME),
+	(uint8_t*)(&app_regs.REG_START_TIME_CHANNELS),
+	(uint8_t*)(app_regs.REG_INTENSITY_SEQUENCE),
+	(uint8_t*)(&app_regs.REG_INTENSITY_SEQUENCE_LENGTH),
+	(uint8_t*)(&app_regs.REG_INTENSITY_SEQUENCE_CHANNEL),
+	(uint8_t*)(app_regs.REG_INTENSITY_LUT_LOW),
+	(uint8_t*)(app_regs.REG_INTENSITY_LUT_HIGH),
+	(uint8_t*)(&app_regs.REG_LASER_POWER),
+	(uint8_t*)(&app_regs.REG_BNC0_ON),
+	(uint8_t*)(&app_regs.REG_BNC1_ON),
+	(uint8_t*)(&app_regs.REG_SIGNAL_A_ON),
+	(uint8_t*)(&app_regs.REG_SIGNAL_B_ON),
+	(uint8_t*)(&app_regs.REG_BNC0_ON),
+	(uint8_t*)(&app_regs.REG_TIMING_UPDATE_MODE),
+	(uint8_t*)(&app_regs.REG_TIMING_COMMIT),
+	(uint8_t*)(&app_regs.REG_SPAD_SWITCH_DEBOUNCE),
+	(uint8_t*)(&app_regs.REG_LASER_STATE_DEBOUNCE),
+	(uint8_t*)(&app_regs.REG_INTERLOCK_LATENCY),
+	(uint8_t*)(app_regs.REG_DIAGNOSTICS),
+	(uint8_t*)(&app_regs.REG_DIAGNOSTICS_RESET),
+	(uint8_t*)(app_regs.REG_LATENCY_HISTOGRAM),
+	(uint8_t*)(app_regs.REG_UART_TX_STATS),
+	(uint8_t*)(app_regs.REG_EDGE_EVENTS),
+	(uint8_t*)(&app_regs.REG_EDGE_EVENTS_CHANNELS),
+	(uint8_t*)(&app_regs.REG_EDGE_EVENTS_LATENCY)
 };
\ No newline at end of file
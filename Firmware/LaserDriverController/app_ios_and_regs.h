@@ -147,6 +147,52 @@ typedef struct
 	uint16_t REG_SIGNAL_B_PULSES;
 	uint16_t REG_SIGNAL_B_TAIL;
 	uint8_t REG_EVNT_ENABLE;
+	uint32_t REG_BNC0_ON_US;
+	uint32_t REG_BNC0_OFF_US;
+	uint32_t REG_BNC0_TAIL_US;
+	uint32_t REG_BNC1_ON_US;
+	uint32_t REG_BNC1_OFF_US;
+	uint32_t REG_BNC1_TAIL_US;
+	uint32_t REG_SIGNAL_A_ON_US;
+	uint32_t REG_SIGNAL_A_OFF_US;
+	uint32_t REG_SIGNAL_A_TAIL_US;
+	uint32_t REG_SIGNAL_B_ON_US;
+	uint32_t REG_SIGNAL_B_OFF_US;
+	uint32_t REG_SIGNAL_B_TAIL_US;
+	uint32_t REG_BNC0_SEQUENCE[32];
+	uint32_t REG_BNC1_SEQUENCE[32];
+	uint32_t REG_SIGNAL_A_SEQUENCE[32];
+	uint32_t REG_SIGNAL_B_SEQUENCE[32];
+	uint16_t REG_SEQUENCE_LOOPS[4];
+	uint8_t REG_SEQUENCE_ENABLE;
+	uint8_t REG_PATTERN[128];
+	uint8_t REG_PATTERN_LENGTH;
+	uint16_t REG_PATTERN_SLOT;
+	uint8_t REG_PATTERN_LOOPS;
+	uint8_t REG_PATTERN_STATE;
+	uint8_t REG_CHANNELS_STATE;
+	uint8_t REG_TRIGGER_MODE;
+	uint8_t REG_TRIGGER_CHANNELS;
+	uint32_t REG_START_TIME[2];
+	uint8_t REG_START_TIME_CHANNELS;
+	uint8_t REG_INTENSITY_SEQUENCE[128];
+	uint8_t REG_INTENSITY_SEQUENCE_LENGTH;
+	uint8_t REG_INTENSITY_SEQUENCE_CHANNEL;
+	uint8_t REG_INTENSITY_LUT_LOW[128];
+	uint8_t REG_INTENSITY_LUT_HIGH[128];
+	uint8_t REG_LASER_POWER;
+	uint8_t REG_TIMING_UPDATE_MODE;
+	uint8_t REG_TIMING_COMMIT;
+	uint8_t REG_SPAD_SWITCH_DEBOUNCE;
+	uint8_t REG_LASER_STATE_DEBOUNCE;
+	uint16_t REG_INTERLOCK_LATENCY;
+	uint16_t REG_DIAGNOSTICS[15];
+	uint8_t REG_DIAGNOSTICS_RESET;
+	uint16_t REG_LATENCY_HISTOGRAM[32];
+	uint32_t REG_UART_TX_STATS[4];
+	uint32_t REG_EDGE_EVENTS[16];
+	uint8_t REG_EDGE_EVENTS_CHANNELS;
+	uint8_t REG_EDGE_EVENTS_LATENCY;
 } AppRegs;
 
 /************************************************************************/
@@ -184,6 +230,57 @@ typedef struct
 #define ADD_REG_SIGNAL_B_PULSES             60 // U16    Number of pulses (SIGNAL_B) [0;65535], 0-> infinite repeat
 #define ADD_REG_SIGNAL_B_TAIL               61 // U16    Wait time between pulses (milliseconds) (SIGNAL_B) [1;65535]
 #define ADD_REG_EVNT_ENABLE                 62 // U8     Enable the Events
+#define ADD_REG_BNC0_ON_US                  63 // U32    Time ON of BNC1 (microseconds) [10;65535000]
+#define ADD_REG_BNC0_OFF_US                 64 // U32    Time OFF of BNC1 (microseconds) 0 or [10;65535000]
+#define ADD_REG_BNC0_TAIL_US                65 // U32    Wait time to start (microseconds) (BNC1) 0 or [10;65535000]
+#define ADD_REG_BNC1_ON_US                  66 // U32    Time ON of BNC2 (microseconds) [10;65535000]
+#define ADD_REG_BNC1_OFF_US                 67 // U32    Time OFF of BNC2 (microseconds) 0 or [10;65535000]
+#define ADD_REG_BNC1_TAIL_US                68 // U32    Wait time to start (microseconds) (BNC2) 0 or [10;65535000]
+#define ADD_REG_SIGNAL_A_ON_US              69 // U32    Time ON of SIGNAL_A (microseconds) [10;65535000]
+#define ADD_REG_SIGNAL_A_OFF_US             70 // U32    Time OFF of SIGNAL_A (microseconds) 0 or [10;65535000]
+#define ADD_REG_SIGNAL_A_TAIL_US            71 // U32    Wait time to start (microseconds) (SIGNAL_A) 0 or [10;65535000]
+#define ADD_REG_SIGNAL_B_ON_US              72 // U32    Time ON of SIGNAL_B (microseconds) [10;65535000]
+#define ADD_REG_SIGNAL_B_OFF_US             73 // U32    Time OFF of SIGNAL_B (microseconds) 0 or [10;65535000]
+#define ADD_REG_SIGNAL_B_TAIL_US            74 // U32    Wait time to start (microseconds) (SIGNAL_B) 0 or [10;65535000]
+#define ADD_REG_BNC0_SEQUENCE               75 // U32[32]Sequence of BNC1, bit 31 -> level, bits 30:0 -> duration (us), 0 ends
+#define ADD_REG_BNC1_SEQUENCE               76 // U32[32]Sequence of BNC2, bit 31 -> level, bits 30:0 -> duration (us), 0 ends
+#define ADD_REG_SIGNAL_A_SEQUENCE           77 // U32[32]Sequence of SIGNAL_A, bit 31 -> level, bits 30:0 -> duration (us), 0 ends
+#define ADD_REG_SIGNAL_B_SEQUENCE           78 // U32[32]Sequence of SIGNAL_B, bit 31 -> level, bits 30:0 -> duration (us), 0 ends
+#define ADD_REG_SEQUENCE_LOOPS              79 // U16[4] Number of times each sequence is played [0;65535], 0-> infinite repeat
+#define ADD_REG_SEQUENCE_ENABLE             80 // U8     Channels that play their sequence instead of the ON/OFF train
+#define ADD_REG_PATTERN                     81 // U8[128]Pattern slots, each one a mask of the pulse channels that are high
+#define ADD_REG_PATTERN_LENGTH              82 // U8     Number of slots of the pattern that are played [1;128]
+#define ADD_REG_PATTERN_SLOT                83 // U16    Duration of each pattern slot (microseconds) [1;2000]
+#define ADD_REG_PATTERN_LOOPS               84 // U8     Number of times the pattern is played [0;255], 0-> infinite repeat
+#define ADD_REG_PATTERN_STATE               85 // U8     Starts (1) or stops (0) the pattern, reads 1 while it is playing
+#define ADD_REG_CHANNELS_STATE              86 // U8     Starts the channels set and stops the others, all on the same timer tick
+#define ADD_REG_TRIGGER_MODE                87 // U8     Edge of the trigger input (DO2) that starts the trigger channels
+#define ADD_REG_TRIGGER_CHANNELS            88 // U8     Channels started by the trigger input
+#define ADD_REG_START_TIME                  89 // U32[2] Harp time of the scheduled start, seconds and microseconds [0;999999]
+#define ADD_REG_START_TIME_CHANNELS         90 // U8     Channels started at START_TIME, 0 cancels, cleared when they start
+#define ADD_REG_INTENSITY_SEQUENCE          91 // U8[128]Laser intensities stepped on the falling edges of INTENSITY_SEQUENCE_CHANNEL
+#define ADD_REG_INTENSITY_SEQUENCE_LENGTH   92 // U8     Number of intensities played before wrapping around [0;128], 0 -> disabled
+#define ADD_REG_INTENSITY_SEQUENCE_CHANNEL  93 // U8     Pulse channel that steps the intensity sequence, a single bit or 0
+#define ADD_REG_INTENSITY_LUT_LOW           94 // U8[128]Digipot value for each LASER_POWER from 0 to 127
+#define ADD_REG_INTENSITY_LUT_HIGH          95 // U8[128]Digipot value for each LASER_POWER from 128 to 255
+#define ADD_REG_LASER_POWER                 96 // U8     Laser power, converted to LASER_INTENSITY through the calibration table
+#define ADD_REG_BNC0_CONFIG                 97 // U16[4] BNC0 ON, OFF, PULSES and TAIL in one write, aliases the four registers
+#define ADD_REG_BNC1_CONFIG                 98 // U16[4] BNC1 ON, OFF, PULSES and TAIL in one write, aliases the four registers
+#define ADD_REG_SIGNAL_A_CONFIG             99 // U16[4] SIGNAL_A ON, OFF, PULSES and TAIL in one write, aliases the four registers
+#define ADD_REG_SIGNAL_B_CONFIG             100 // U16[4] SIGNAL_B ON, OFF, PULSES and TAIL in one write, aliases the four registers
+#define ADD_REG_CHANNELS_CONFIG             101 // U16[16] ON, OFF, PULSES and TAIL of the four channels, aliases BNC0_ON to SIGNAL_B_TAIL
+#define ADD_REG_TIMING_UPDATE_MODE          102 // U8     Running trains take new times right away (0) or only on TIMING_COMMIT (1)
+#define ADD_REG_TIMING_COMMIT               103 // U8     Channels whose staged times are applied together, at their next pulse
+#define ADD_REG_SPAD_SWITCH_DEBOUNCE        104 // U8     Debounce window of SWITCH_5V (milliseconds) [0;255], 0 -> disabled
+#define ADD_REG_LASER_STATE_DEBOUNCE        105 // U8     Debounce window of ON_OFF_KEY (milliseconds) [0;255], 0 -> disabled
+#define ADD_REG_INTERLOCK_LATENCY           106 // U16    Time from the key switch going off to the laser outputs low (microseconds)
+#define ADD_REG_DIAGNOSTICS                 107 // U16[15]Min, max and mean execution time of each instrumented path (CPU cycles)
+#define ADD_REG_DIAGNOSTICS_RESET           108 // U8     Bit 0 clears DIAGNOSTICS, bit 1 LATENCY_HISTOGRAM, bit 2 UART_TX_STATS
+#define ADD_REG_LATENCY_HISTOGRAM           109 // U16[32]Write-to-effect latencies, bin n counts [2^(n-1);2^n[ microseconds
+#define ADD_REG_UART_TX_STATS               110 // U32[4] UART TX fill and high-water mark (bytes), events dropped, CTS stall time (microseconds)
+#define ADD_REG_EDGE_EVENTS                 111 // U32[16]Batch of pulse edges, level (bit 31), channel (bits 30-28) and offset (us, bits 27-0)
+#define ADD_REG_EDGE_EVENTS_CHANNELS        112 // U8     Channels whose edges are reported in EDGE_EVENTS, 0 -> disabled
+#define ADD_REG_EDGE_EVENTS_LATENCY         113 // U8     Longest time an edge waits before its batch is sent (milliseconds) [1;255]
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -193,8 +290,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x3E
-#define APP_NBYTES_OF_REG_BANK              49
+#define APP_REGS_ADD_MAX                    0x71
+#define APP_NBYTES_OF_REG_BANK              1333
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -211,5 +308,18 @@ typedef struct
 #define B_SIGNAL_B                         (1<<1)       // SIGNAL_B start/stop
 #define B_EVT_SPAD_SWITCH                  (1<<0)       // Event of register SPAD_SWITCH
 #define B_EVT_LASER_STATE                  (1<<1)       // Event of register LASER_STATE
+#define B_EVT_BNCS_STATE                   (1<<2)       // Event of register BNCS_STATE
+#define B_EVT_SIGNAL_STATE                 (1<<3)       // Event of register SIGNAL_STATE
+#define B_CH_BNC1                          (1<<0)       // BNC1 pulse channel
+#define B_CH_BNC2                          (1<<1)       // BNC2 pulse channel
+#define B_CH_SIGNAL_A                      (1<<2)       // SIGNAL_A pulse channel
+#define B_CH_SIGNAL_B                      (1<<3)       // SIGNAL_B pulse channel
+#define B_CH_ALL                           (B_CH_BNC1 | B_CH_BNC2 | B_CH_SIGNAL_A | B_CH_SIGNAL_B)
+#define GM_TRIGGER_DISABLED                0            // DO2 is a digital output
+#define GM_TRIGGER_RISING                  1            // Start on the rising edge of DO2
+#define GM_TRIGGER_FALLING                 2            // Start on the falling edge of DO2
+#define GM_TRIGGER_BOTH                    3            // Start on both edges of DO2
+#define GM_TIMING_IMMEDIATE                0            // Running trains take new times at their next pulse
+#define GM_TIMING_STAGED                   1            // New times wait for TIMING_COMMIT
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
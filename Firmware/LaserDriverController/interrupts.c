@@ -8,6 +8,7 @@
 /* Declare application registers                                        */
 /************************************************************************/
 extern AppRegs app_regs;
+extern uint8_t trigger_pins, pulse_first_high_pins;
 
 /************************************************************************/
 /* Interrupts from Timers                                               */
@@ -27,65 +28,78 @@ extern AppRegs app_regs;
 //
 // ISR(TCD1_CCA_vect, ISR_NAKED)
 
+/************************************************************************/
+/* Pulse engine edges                                                   */
+/************************************************************************/
+ISR(TCD0_CCA_vect)
+{
+	uint16_t diag_start = diag_now();
+	pulse_schedule();
+	diag_end(DIAG_PULSE_EDGES, diag_start);
+}
+
+ISR(TCD1_CCA_vect)
+{
+	uint16_t diag_start = diag_now();
+	pulse_schedule();
+	diag_end(DIAG_PULSE_EDGES, diag_start);
+}
+
+/************************************************************************/
+/* Pattern output end                                                   */
+/************************************************************************/
+ISR(DMA_CH0_vect)
+{
+	/* The last slot has just ended */
+	pattern_stop();
+}
+
+/************************************************************************/
+/* Trigger input (DO2)                                                  */
+/************************************************************************/
+ISR(PORTC_INT0_vect)
+{
+	/* Nothing starts while the key is off or the device is in standby */
+	if (!read_ON_OFF_KEY || !core_bool_device_is_active())
+		return;
+
+	PORTJ.OUTSET = trigger_pins & pulse_first_high_pins;
+	trigger_fire();
+}
+
+/************************************************************************/
+/* Digipot SPI                                                          */
+/************************************************************************/
+ISR(SPID_INT_vect)
+{
+	digipot_spi_done();
+}
+
+/************************************************************************/
+/* Input debounce windows                                               */
+/************************************************************************/
+ISR(TCE0_CCA_vect) { input_debounce_done(INPUT_ON_OFF_KEY); }
+ISR(TCE0_CCB_vect) { input_debounce_done(INPUT_SWITCH_5V); }
+
 /************************************************************************/
 /* ON_OFF_KEY                                                           */
 /************************************************************************/
-ISR(PORTH_INT0_vect, ISR_NAKED)
+ISR(PORTH_INT0_vect)
 {
-	/*uint8_t reg_laser_state = app_regs.REG_LASER_STATE;
-	if(read_ON_OFF_KEY){
-		if(app_regs.REG_EVNT_ENABLE & B_EVT_LASER_STATE ){
-			app_regs.REG_LASER_STATE = 1;
-			if(reg_laser_state != app_regs.REG_LASER_STATE){
-				core_func_send_event(ADD_REG_LASER_STATE, true);
-			}
-		}
-	}
-	else{
-		if(app_regs.REG_EVNT_ENABLE & B_EVT_LASER_STATE ){
-			app_regs.REG_LASER_STATE = 0;
-			if(reg_laser_state != app_regs.REG_LASER_STATE){
-				core_func_send_event(ADD_REG_LASER_STATE, true);
-			}
-		}
-	}*/
-	
-	
-	app_regs.REG_RESERVED2 = 2;
+	input_edge_detected(INPUT_ON_OFF_KEY);
+}
 
-	reti();
+ISR(PORTH_INT1_vect)
+{
+	interlock_fire();
 }
 
 /************************************************************************/
 /* SWITCH_5V                                                            */
 /************************************************************************/
 //ONLY IF PHYSICAL SWITCH IS CONNECTED
-ISR(PORTE_INT0_vect, ISR_NAKED)
+ISR(PORTE_INT0_vect)
 {
-	app_regs.REG_RESERVED1 = 2; 
-	
-	
-	/*uint8_t reg_spad_switch = app_regs.REG_SPAD_SWITCH;
-
-	if(read_SWITCH_5V){
-		if(app_regs.REG_EVNT_ENABLE &  B_EVT_SPAD_SWITCH ){
-			app_regs.REG_SPAD_SWITCH = 1;
-			set_MCU_TO_RELAY;
-			if(reg_spad_switch  != app_regs.REG_SPAD_SWITCH){
-				core_func_send_event(ADD_REG_SPAD_SWITCH, true);
-			}
-		}
-	}
-	else{
-		if(app_regs.REG_EVNT_ENABLE & B_EVT_SPAD_SWITCH ){
-			app_regs.REG_SPAD_SWITCH = 0;
-			clr_MCU_TO_RELAY;
-			if(reg_spad_switch != app_regs.REG_SPAD_SWITCH){
-				core_func_send_event(ADD_REG_SPAD_SWITCH, true);
-			}
-		}
-	}*/
-
-	reti();
+	input_edge_detected(INPUT_SWITCH_5V);
 }
 
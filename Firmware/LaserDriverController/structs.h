@@ -1,24 +1,69 @@
 #ifndef _STRUCTS_H_
-#define _STRUCTS_H
+#define _STRUCTS_H_
 
+/* What a channel does when its deadline is reached */
+#define PHASE_ON	0	// output goes high, a pulse starts
+#define PHASE_OFF	1	// output goes low, the OFF part of the pulse starts
+#define PHASE_END	2	// output goes low and the train stops
 
 typedef struct
 {
-	uint16_t period_bnc0, period_bnc1, period_signal_a, period_signal_b;
-    uint16_t tail_bnc0, tail_bnc1, tail_signal_a, tail_signal_b;
-    uint16_t t_bnc0, t_bnc1, t_signal_a, t_signal_b;
-    uint16_t count_pulses_bnc0, count_pulses_bnc1, count_pulses_signal_a, count_pulses_signal_b; 
+	uint8_t phase;				// edge produced at the deadline
+	uint32_t deadline;			// time of the next edge, in pulse engine ticks
+	uint16_t count_pulses;		// pulses (or sequence loops) left, including the current one (0 -> infinite)
+	uint8_t seq_index;			// sequence segment that starts at the deadline
 } countdown_t;
 
 
-typedef struct 
+typedef struct
 {
-   uint16_t on_ms, off_ms;
+   uint32_t on_us, off_us;
    uint16_t pulses;
-   uint16_t tail_ms;
+   uint32_t tail_us;
 } interval_t;
 
 
+typedef struct
+{
+	interval_t cfg;				// timings latched when the train starts
+	countdown_t t;
+	uint8_t pin_mask;			// output pin on PORTJ
+	uint8_t state_mask;			// start/stop register bit cleared when the train ends
+	uint32_t *sequence;			// segments played instead of the ON/OFF train (optional)
+	bool play_sequence;
+	uint32_t *timing_us;		// ON_US register, followed by OFF_US and TAIL_US (optional)
+	uint16_t *pulses;			// PULSES register (optional)
+	interval_t bank;			// timings read by starts, only updated by a commit in staged mode
+	uint32_t next_on_us;		// times taken by a running train at its next pulse
+	uint32_t next_off_us;
+	volatile bool reload;
+} channel_t;
+
+
+typedef struct
+{
+	uint8_t input;				// INPUT_SWITCH_5V or INPUT_ON_OFF_KEY
+	uint8_t level;				// pin level right after the edge
+	uint32_t ticks;				// pulse engine time of the edge
+} input_edge_t;
+
+
+typedef struct
+{
+	uint8_t channel;			// index in the channel table
+	uint8_t level;				// output level after the edge
+	uint32_t ticks;				// pulse engine time of the edge
+} pulse_edge_t;
+
+
+typedef struct
+{
+	uint8_t add;				// ADD_REG_BNCS_STATE or ADD_REG_SIGNAL_STATE
+	uint8_t value;				// register value after the change
+	uint32_t ticks;				// pulse engine time of the change
+} state_change_t;
+
+
 typedef struct{
 
     bool bnc_0, bnc_1, signal_a, signal_b;
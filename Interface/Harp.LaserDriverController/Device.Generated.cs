@@ -67,7 +67,58 @@ namespace Harp.LaserDriverController
             { 59, typeof(SignalBOff) },
             { 60, typeof(SignalBPulses) },
             { 61, typeof(SignalBTail) },
-            { 62, typeof(EventEnable) }
+            { 62, typeof(EventEnable) },
+            { 63, typeof(Bnc1OnMicroseconds) },
+            { 64, typeof(Bnc1OffMicroseconds) },
+            { 65, typeof(Bnc1TailMicroseconds) },
+            { 66, typeof(Bnc2OnMicroseconds) },
+            { 67, typeof(Bnc2OffMicroseconds) },
+            { 68, typeof(Bnc2TailMicroseconds) },
+            { 69, typeof(SignalAOnMicroseconds) },
+            { 70, typeof(SignalAOffMicroseconds) },
+            { 71, typeof(SignalATailMicroseconds) },
+            { 72, typeof(SignalBOnMicroseconds) },
+            { 73, typeof(SignalBOffMicroseconds) },
+            { 74, typeof(SignalBTailMicroseconds) },
+            { 75, typeof(Bnc1Sequence) },
+            { 76, typeof(Bnc2Sequence) },
+            { 77, typeof(SignalASequence) },
+            { 78, typeof(SignalBSequence) },
+            { 79, typeof(SequenceLoops) },
+            { 80, typeof(SequenceEnable) },
+            { 81, typeof(Pattern) },
+            { 82, typeof(PatternLength) },
+            { 83, typeof(PatternSlot) },
+            { 84, typeof(PatternLoops) },
+            { 85, typeof(PatternState) },
+            { 86, typeof(ChannelsState) },
+            { 87, typeof(TriggerMode) },
+            { 88, typeof(TriggerChannels) },
+            { 89, typeof(StartTime) },
+            { 90, typeof(StartTimeChannels) },
+            { 91, typeof(IntensitySequence) },
+            { 92, typeof(IntensitySequenceLength) },
+            { 93, typeof(IntensitySequenceChannel) },
+            { 94, typeof(IntensityLutLow) },
+            { 95, typeof(IntensityLutHigh) },
+            { 96, typeof(LaserPower) },
+            { 97, typeof(Bnc1Config) },
+            { 98, typeof(Bnc2Config) },
+            { 99, typeof(SignalAConfig) },
+            { 100, typeof(SignalBConfig) },
+            { 101, typeof(ChannelsConfig) },
+            { 102, typeof(TimingUpdateMode) },
+            { 103, typeof(TimingCommit) },
+            { 104, typeof(SpadSwitchDebounce) },
+            { 105, typeof(LaserStateDebounce) },
+            { 106, typeof(InterlockLatency) },
+            { 107, typeof(Diagnostics) },
+            { 108, typeof(DiagnosticsReset) },
+            { 109, typeof(LatencyHistogram) },
+            { 110, typeof(UartTxStats) },
+            { 111, typeof(EdgeEvents) },
+            { 112, typeof(EdgeEventsChannels) },
+            { 113, typeof(EdgeEventsLatency) }
         };
 
         /// <summary>
@@ -308,6 +359,57 @@ namespace Harp.LaserDriverController
     /// <seealso cref="SignalBPulses"/>
     /// <seealso cref="SignalBTail"/>
     /// <seealso cref="EventEnable"/>
+    /// <seealso cref="Bnc1OnMicroseconds"/>
+    /// <seealso cref="Bnc1OffMicroseconds"/>
+    /// <seealso cref="Bnc1TailMicroseconds"/>
+    /// <seealso cref="Bnc2OnMicroseconds"/>
+    /// <seealso cref="Bnc2OffMicroseconds"/>
+    /// <seealso cref="Bnc2TailMicroseconds"/>
+    /// <seealso cref="SignalAOnMicroseconds"/>
+    /// <seealso cref="SignalAOffMicroseconds"/>
+    /// <seealso cref="SignalATailMicroseconds"/>
+    /// <seealso cref="SignalBOnMicroseconds"/>
+    /// <seealso cref="SignalBOffMicroseconds"/>
+    /// <seealso cref="SignalBTailMicroseconds"/>
+    /// <seealso cref="Bnc1Sequence"/>
+    /// <seealso cref="Bnc2Sequence"/>
+    /// <seealso cref="SignalASequence"/>
+    /// <seealso cref="SignalBSequence"/>
+    /// <seealso cref="SequenceLoops"/>
+    /// <seealso cref="SequenceEnable"/>
+    /// <seealso cref="Pattern"/>
+    /// <seealso cref="PatternLength"/>
+    /// <seealso cref="PatternSlot"/>
+    /// <seealso cref="PatternLoops"/>
+    /// <seealso cref="PatternState"/>
+    /// <seealso cref="ChannelsState"/>
+    /// <seealso cref="TriggerMode"/>
+    /// <seealso cref="TriggerChannels"/>
+    /// <seealso cref="StartTime"/>
+    /// <seealso cref="StartTimeChannels"/>
+    /// <seealso cref="IntensitySequence"/>
+    /// <seealso cref="IntensitySequenceLength"/>
+    /// <seealso cref="IntensitySequenceChannel"/>
+    /// <seealso cref="IntensityLutLow"/>
+    /// <seealso cref="IntensityLutHigh"/>
+    /// <seealso cref="LaserPower"/>
+    /// <seealso cref="Bnc1Config"/>
+    /// <seealso cref="Bnc2Config"/>
+    /// <seealso cref="SignalAConfig"/>
+    /// <seealso cref="SignalBConfig"/>
+    /// <seealso cref="ChannelsConfig"/>
+    /// <seealso cref="TimingUpdateMode"/>
+    /// <seealso cref="TimingCommit"/>
+    /// <seealso cref="SpadSwitchDebounce"/>
+    /// <seealso cref="LaserStateDebounce"/>
+    /// <seealso cref="InterlockLatency"/>
+    /// <seealso cref="Diagnostics"/>
+    /// <seealso cref="DiagnosticsReset"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="UartTxStats"/>
+    /// <seealso cref="EdgeEvents"/>
+    /// <seealso cref="EdgeEventsChannels"/>
+    /// <seealso cref="EdgeEventsLatency"/>
     [XmlInclude(typeof(SpadSwitch))]
     [XmlInclude(typeof(LaserState))]
     [XmlInclude(typeof(LaserFrequencySelect))]
@@ -335,6 +437,57 @@ namespace Harp.LaserDriverController
     [XmlInclude(typeof(SignalBPulses))]
     [XmlInclude(typeof(SignalBTail))]
     [XmlInclude(typeof(EventEnable))]
+    [XmlInclude(typeof(Bnc1OnMicroseconds))]
+    [XmlInclude(typeof(Bnc1OffMicroseconds))]
+    [XmlInclude(typeof(Bnc1TailMicroseconds))]
+    [XmlInclude(typeof(Bnc2OnMicroseconds))]
+    [XmlInclude(typeof(Bnc2OffMicroseconds))]
+    [XmlInclude(typeof(Bnc2TailMicroseconds))]
+    [XmlInclude(typeof(SignalAOnMicroseconds))]
+    [XmlInclude(typeof(SignalAOffMicroseconds))]
+    [XmlInclude(typeof(SignalATailMicroseconds))]
+    [XmlInclude(typeof(SignalBOnMicroseconds))]
+    [XmlInclude(typeof(SignalBOffMicroseconds))]
+    [XmlInclude(typeof(SignalBTailMicroseconds))]
+    [XmlInclude(typeof(Bnc1Sequence))]
+    [XmlInclude(typeof(Bnc2Sequence))]
+    [XmlInclude(typeof(SignalASequence))]
+    [XmlInclude(typeof(SignalBSequence))]
+    [XmlInclude(typeof(SequenceLoops))]
+    [XmlInclude(typeof(SequenceEnable))]
+    [XmlInclude(typeof(Pattern))]
+    [XmlInclude(typeof(PatternLength))]
+    [XmlInclude(typeof(PatternSlot))]
+    [XmlInclude(typeof(PatternLoops))]
+    [XmlInclude(typeof(PatternState))]
+    [XmlInclude(typeof(ChannelsState))]
+    [XmlInclude(typeof(TriggerMode))]
+    [XmlInclude(typeof(TriggerChannels))]
+    [XmlInclude(typeof(StartTime))]
+    [XmlInclude(typeof(StartTimeChannels))]
+    [XmlInclude(typeof(IntensitySequence))]
+    [XmlInclude(typeof(IntensitySequenceLength))]
+    [XmlInclude(typeof(IntensitySequenceChannel))]
+    [XmlInclude(typeof(IntensityLutLow))]
+    [XmlInclude(typeof(IntensityLutHigh))]
+    [XmlInclude(typeof(LaserPower))]
+    [XmlInclude(typeof(Bnc1Config))]
+    [XmlInclude(typeof(Bnc2Config))]
+    [XmlInclude(typeof(SignalAConfig))]
+    [XmlInclude(typeof(SignalBConfig))]
+    [XmlInclude(typeof(ChannelsConfig))]
+    [XmlInclude(typeof(TimingUpdateMode))]
+    [XmlInclude(typeof(TimingCommit))]
+    [XmlInclude(typeof(SpadSwitchDebounce))]
+    [XmlInclude(typeof(LaserStateDebounce))]
+    [XmlInclude(typeof(InterlockLatency))]
+    [XmlInclude(typeof(Diagnostics))]
+    [XmlInclude(typeof(DiagnosticsReset))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(UartTxStats))]
+    [XmlInclude(typeof(EdgeEvents))]
+    [XmlInclude(typeof(EdgeEventsChannels))]
+    [XmlInclude(typeof(EdgeEventsLatency))]
     [Description("Filters register-specific messages reported by the LaserDriverController device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -383,6 +536,57 @@ namespace Harp.LaserDriverController
     /// <seealso cref="SignalBPulses"/>
     /// <seealso cref="SignalBTail"/>
     /// <seealso cref="EventEnable"/>
+    /// <seealso cref="Bnc1OnMicroseconds"/>
+    /// <seealso cref="Bnc1OffMicroseconds"/>
+    /// <seealso cref="Bnc1TailMicroseconds"/>
+    /// <seealso cref="Bnc2OnMicroseconds"/>
+    /// <seealso cref="Bnc2OffMicroseconds"/>
+    /// <seealso cref="Bnc2TailMicroseconds"/>
+    /// <seealso cref="SignalAOnMicroseconds"/>
+    /// <seealso cref="SignalAOffMicroseconds"/>
+    /// <seealso cref="SignalATailMicroseconds"/>
+    /// <seealso cref="SignalBOnMicroseconds"/>
+    /// <seealso cref="SignalBOffMicroseconds"/>
+    /// <seealso cref="SignalBTailMicroseconds"/>
+    /// <seealso cref="Bnc1Sequence"/>
+    /// <seealso cref="Bnc2Sequence"/>
+    /// <seealso cref="SignalASequence"/>
+    /// <seealso cref="SignalBSequence"/>
+    /// <seealso cref="SequenceLoops"/>
+    /// <seealso cref="SequenceEnable"/>
+    /// <seealso cref="Pattern"/>
+    /// <seealso cref="PatternLength"/>
+    /// <seealso cref="PatternSlot"/>
+    /// <seealso cref="PatternLoops"/>
+    /// <seealso cref="PatternState"/>
+    /// <seealso cref="ChannelsState"/>
+    /// <seealso cref="TriggerMode"/>
+    /// <seealso cref="TriggerChannels"/>
+    /// <seealso cref="StartTime"/>
+    /// <seealso cref="StartTimeChannels"/>
+    /// <seealso cref="IntensitySequence"/>
+    /// <seealso cref="IntensitySequenceLength"/>
+    /// <seealso cref="IntensitySequenceChannel"/>
+    /// <seealso cref="IntensityLutLow"/>
+    /// <seealso cref="IntensityLutHigh"/>
+    /// <seealso cref="LaserPower"/>
+    /// <seealso cref="Bnc1Config"/>
+    /// <seealso cref="Bnc2Config"/>
+    /// <seealso cref="SignalAConfig"/>
+    /// <seealso cref="SignalBConfig"/>
+    /// <seealso cref="ChannelsConfig"/>
+    /// <seealso cref="TimingUpdateMode"/>
+    /// <seealso cref="TimingCommit"/>
+    /// <seealso cref="SpadSwitchDebounce"/>
+    /// <seealso cref="LaserStateDebounce"/>
+    /// <seealso cref="InterlockLatency"/>
+    /// <seealso cref="Diagnostics"/>
+    /// <seealso cref="DiagnosticsReset"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="UartTxStats"/>
+    /// <seealso cref="EdgeEvents"/>
+    /// <seealso cref="EdgeEventsChannels"/>
+    /// <seealso cref="EdgeEventsLatency"/>
     [XmlInclude(typeof(SpadSwitch))]
     [XmlInclude(typeof(LaserState))]
     [XmlInclude(typeof(LaserFrequencySelect))]
@@ -410,6 +614,57 @@ namespace Harp.LaserDriverController
     [XmlInclude(typeof(SignalBPulses))]
     [XmlInclude(typeof(SignalBTail))]
     [XmlInclude(typeof(EventEnable))]
+    [XmlInclude(typeof(Bnc1OnMicroseconds))]
+    [XmlInclude(typeof(Bnc1OffMicroseconds))]
+    [XmlInclude(typeof(Bnc1TailMicroseconds))]
+    [XmlInclude(typeof(Bnc2OnMicroseconds))]
+    [XmlInclude(typeof(Bnc2OffMicroseconds))]
+    [XmlInclude(typeof(Bnc2TailMicroseconds))]
+    [XmlInclude(typeof(SignalAOnMicroseconds))]
+    [XmlInclude(typeof(SignalAOffMicroseconds))]
+    [XmlInclude(typeof(SignalATailMicroseconds))]
+    [XmlInclude(typeof(SignalBOnMicroseconds))]
+    [XmlInclude(typeof(SignalBOffMicroseconds))]
+    [XmlInclude(typeof(SignalBTailMicroseconds))]
+    [XmlInclude(typeof(Bnc1Sequence))]
+    [XmlInclude(typeof(Bnc2Sequence))]
+    [XmlInclude(typeof(SignalASequence))]
+    [XmlInclude(typeof(SignalBSequence))]
+    [XmlInclude(typeof(SequenceLoops))]
+    [XmlInclude(typeof(SequenceEnable))]
+    [XmlInclude(typeof(Pattern))]
+    [XmlInclude(typeof(PatternLength))]
+    [XmlInclude(typeof(PatternSlot))]
+    [XmlInclude(typeof(PatternLoops))]
+    [XmlInclude(typeof(PatternState))]
+    [XmlInclude(typeof(ChannelsState))]
+    [XmlInclude(typeof(TriggerMode))]
+    [XmlInclude(typeof(TriggerChannels))]
+    [XmlInclude(typeof(StartTime))]
+    [XmlInclude(typeof(StartTimeChannels))]
+    [XmlInclude(typeof(IntensitySequence))]
+    [XmlInclude(typeof(IntensitySequenceLength))]
+    [XmlInclude(typeof(IntensitySequenceChannel))]
+    [XmlInclude(typeof(IntensityLutLow))]
+    [XmlInclude(typeof(IntensityLutHigh))]
+    [XmlInclude(typeof(LaserPower))]
+    [XmlInclude(typeof(Bnc1Config))]
+    [XmlInclude(typeof(Bnc2Config))]
+    [XmlInclude(typeof(SignalAConfig))]
+    [XmlInclude(typeof(SignalBConfig))]
+    [XmlInclude(typeof(ChannelsConfig))]
+    [XmlInclude(typeof(TimingUpdateMode))]
+    [XmlInclude(typeof(TimingCommit))]
+    [XmlInclude(typeof(SpadSwitchDebounce))]
+    [XmlInclude(typeof(LaserStateDebounce))]
+    [XmlInclude(typeof(InterlockLatency))]
+    [XmlInclude(typeof(Diagnostics))]
+    [XmlInclude(typeof(DiagnosticsReset))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(UartTxStats))]
+    [XmlInclude(typeof(EdgeEvents))]
+    [XmlInclude(typeof(EdgeEventsChannels))]
+    [XmlInclude(typeof(EdgeEventsLatency))]
     [XmlInclude(typeof(TimestampedSpadSwitch))]
     [XmlInclude(typeof(TimestampedLaserState))]
     [XmlInclude(typeof(TimestampedLaserFrequencySelect))]
@@ -437,6 +692,57 @@ namespace Harp.LaserDriverController
     [XmlInclude(typeof(TimestampedSignalBPulses))]
     [XmlInclude(typeof(TimestampedSignalBTail))]
     [XmlInclude(typeof(TimestampedEventEnable))]
+    [XmlInclude(typeof(TimestampedBnc1OnMicroseconds))]
+    [XmlInclude(typeof(TimestampedBnc1OffMicroseconds))]
+    [XmlInclude(typeof(TimestampedBnc1TailMicroseconds))]
+    [XmlInclude(typeof(TimestampedBnc2OnMicroseconds))]
+    [XmlInclude(typeof(TimestampedBnc2OffMicroseconds))]
+    [XmlInclude(typeof(TimestampedBnc2TailMicroseconds))]
+    [XmlInclude(typeof(TimestampedSignalAOnMicroseconds))]
+    [XmlInclude(typeof(TimestampedSignalAOffMicroseconds))]
+    [XmlInclude(typeof(TimestampedSignalATailMicroseconds))]
+    [XmlInclude(typeof(TimestampedSignalBOnMicroseconds))]
+    [XmlInclude(typeof(TimestampedSignalBOffMicroseconds))]
+    [XmlInclude(typeof(TimestampedSignalBTailMicroseconds))]
+    [XmlInclude(typeof(TimestampedBnc1Sequence))]
+    [XmlInclude(typeof(TimestampedBnc2Sequence))]
+    [XmlInclude(typeof(TimestampedSignalASequence))]
+    [XmlInclude(typeof(TimestampedSignalBSequence))]
+    [XmlInclude(typeof(TimestampedSequenceLoops))]
+    [XmlInclude(typeof(TimestampedSequenceEnable))]
+    [XmlInclude(typeof(TimestampedPattern))]
+    [XmlInclude(typeof(TimestampedPatternLength))]
+    [XmlInclude(typeof(TimestampedPatternSlot))]
+    [XmlInclude(typeof(TimestampedPatternLoops))]
+    [XmlInclude(typeof(TimestampedPatternState))]
+    [XmlInclude(typeof(TimestampedChannelsState))]
+    [XmlInclude(typeof(TimestampedTriggerMode))]
+    [XmlInclude(typeof(TimestampedTriggerChannels))]
+    [XmlInclude(typeof(TimestampedStartTime))]
+    [XmlInclude(typeof(TimestampedStartTimeChannels))]
+    [XmlInclude(typeof(TimestampedIntensitySequence))]
+    [XmlInclude(typeof(TimestampedIntensitySequenceLength))]
+    [XmlInclude(typeof(TimestampedIntensitySequenceChannel))]
+    [XmlInclude(typeof(TimestampedIntensityLutLow))]
+    [XmlInclude(typeof(TimestampedIntensityLutHigh))]
+    [XmlInclude(typeof(TimestampedLaserPower))]
+    [XmlInclude(typeof(TimestampedBnc1Config))]
+    [XmlInclude(typeof(TimestampedBnc2Config))]
+    [XmlInclude(typeof(TimestampedSignalAConfig))]
+    [XmlInclude(typeof(TimestampedSignalBConfig))]
+    [XmlInclude(typeof(TimestampedChannelsConfig))]
+    [XmlInclude(typeof(TimestampedTimingUpdateMode))]
+    [XmlInclude(typeof(TimestampedTimingCommit))]
+    [XmlInclude(typeof(TimestampedSpadSwitchDebounce))]
+    [XmlInclude(typeof(TimestampedLaserStateDebounce))]
+    [XmlInclude(typeof(TimestampedInterlockLatency))]
+    [XmlInclude(typeof(TimestampedDiagnostics))]
+    [XmlInclude(typeof(TimestampedDiagnosticsReset))]
+    [XmlInclude(typeof(TimestampedLatencyHistogram))]
+    [XmlInclude(typeof(TimestampedUartTxStats))]
+    [XmlInclude(typeof(TimestampedEdgeEvents))]
+    [XmlInclude(typeof(TimestampedEdgeEventsChannels))]
+    [XmlInclude(typeof(TimestampedEdgeEventsLatency))]
     [Description("Filters and selects specific messages reported by the LaserDriverController device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -482,6 +788,57 @@ namespace Harp.LaserDriverController
     /// <seealso cref="SignalBPulses"/>
     /// <seealso cref="SignalBTail"/>
     /// <seealso cref="EventEnable"/>
+    /// <seealso cref="Bnc1OnMicroseconds"/>
+    /// <seealso cref="Bnc1OffMicroseconds"/>
+    /// <seealso cref="Bnc1TailMicroseconds"/>
+    /// <seealso cref="Bnc2OnMicroseconds"/>
+    /// <seealso cref="Bnc2OffMicroseconds"/>
+    /// <seealso cref="Bnc2TailMicroseconds"/>
+    /// <seealso cref="SignalAOnMicroseconds"/>
+    /// <seealso cref="SignalAOffMicroseconds"/>
+    /// <seealso cref="SignalATailMicroseconds"/>
+    /// <seealso cref="SignalBOnMicroseconds"/>
+    /// <seealso cref="SignalBOffMicroseconds"/>
+    /// <seealso cref="SignalBTailMicroseconds"/>
+    /// <seealso cref="Bnc1Sequence"/>
+    /// <seealso cref="Bnc2Sequence"/>
+    /// <seealso cref="SignalASequence"/>
+    /// <seealso cref="SignalBSequence"/>
+    /// <seealso cref="SequenceLoops"/>
+    /// <seealso cref="SequenceEnable"/>
+    /// <seealso cref="Pattern"/>
+    /// <seealso cref="PatternLength"/>
+    /// <seealso cref="PatternSlot"/>
+    /// <seealso cref="PatternLoops"/>
+    /// <seealso cref="PatternState"/>
+    /// <seealso cref="ChannelsState"/>
+    /// <seealso cref="TriggerMode"/>
+    /// <seealso cref="TriggerChannels"/>
+    /// <seealso cref="StartTime"/>
+    /// <seealso cref="StartTimeChannels"/>
+    /// <seealso cref="IntensitySequence"/>
+    /// <seealso cref="IntensitySequenceLength"/>
+    /// <seealso cref="IntensitySequenceChannel"/>
+    /// <seealso cref="IntensityLutLow"/>
+    /// <seealso cref="IntensityLutHigh"/>
+    /// <seealso cref="LaserPower"/>
+    /// <seealso cref="Bnc1Config"/>
+    /// <seealso cref="Bnc2Config"/>
+    /// <seealso cref="SignalAConfig"/>
+    /// <seealso cref="SignalBConfig"/>
+    /// <seealso cref="ChannelsConfig"/>
+    /// <seealso cref="TimingUpdateMode"/>
+    /// <seealso cref="TimingCommit"/>
+    /// <seealso cref="SpadSwitchDebounce"/>
+    /// <seealso cref="LaserStateDebounce"/>
+    /// <seealso cref="InterlockLatency"/>
+    /// <seealso cref="Diagnostics"/>
+    /// <seealso cref="DiagnosticsReset"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="UartTxStats"/>
+    /// <seealso cref="EdgeEvents"/>
+    /// <seealso cref="EdgeEventsChannels"/>
+    /// <seealso cref="EdgeEventsLatency"/>
     [XmlInclude(typeof(SpadSwitch))]
     [XmlInclude(typeof(LaserState))]
     [XmlInclude(typeof(LaserFrequencySelect))]
@@ -509,6 +866,57 @@ namespace Harp.LaserDriverController
     [XmlInclude(typeof(SignalBPulses))]
     [XmlInclude(typeof(SignalBTail))]
     [XmlInclude(typeof(EventEnable))]
+    [XmlInclude(typeof(Bnc1OnMicroseconds))]
+    [XmlInclude(typeof(Bnc1OffMicroseconds))]
+    [XmlInclude(typeof(Bnc1TailMicroseconds))]
+    [XmlInclude(typeof(Bnc2OnMicroseconds))]
+    [XmlInclude(typeof(Bnc2OffMicroseconds))]
+    [XmlInclude(typeof(Bnc2TailMicroseconds))]
+    [XmlInclude(typeof(SignalAOnMicroseconds))]
+    [XmlInclude(typeof(SignalAOffMicroseconds))]
+    [XmlInclude(typeof(SignalATailMicroseconds))]
+    [XmlInclude(typeof(SignalBOnMicroseconds))]
+    [XmlInclude(typeof(SignalBOffMicroseconds))]
+    [XmlInclude(typeof(SignalBTailMicroseconds))]
+    [XmlInclude(typeof(Bnc1Sequence))]
+    [XmlInclude(typeof(Bnc2Sequence))]
+    [XmlInclude(typeof(SignalASequence))]
+    [XmlInclude(typeof(SignalBSequence))]
+    [XmlInclude(typeof(SequenceLoops))]
+    [XmlInclude(typeof(SequenceEnable))]
+    [XmlInclude(typeof(Pattern))]
+    [XmlInclude(typeof(PatternLength))]
+    [XmlInclude(typeof(PatternSlot))]
+    [XmlInclude(typeof(PatternLoops))]
+    [XmlInclude(typeof(PatternState))]
+    [XmlInclude(typeof(ChannelsState))]
+    [XmlInclude(typeof(TriggerMode))]
+    [XmlInclude(typeof(TriggerChannels))]
+    [XmlInclude(typeof(StartTime))]
+    [XmlInclude(typeof(StartTimeChannels))]
+    [XmlInclude(typeof(IntensitySequence))]
+    [XmlInclude(typeof(IntensitySequenceLength))]
+    [XmlInclude(typeof(IntensitySequenceChannel))]
+    [XmlInclude(typeof(IntensityLutLow))]
+    [XmlInclude(typeof(IntensityLutHigh))]
+    [XmlInclude(typeof(LaserPower))]
+    [XmlInclude(typeof(Bnc1Config))]
+    [XmlInclude(typeof(Bnc2Config))]
+    [XmlInclude(typeof(SignalAConfig))]
+    [XmlInclude(typeof(SignalBConfig))]
+    [XmlInclude(typeof(ChannelsConfig))]
+    [XmlInclude(typeof(TimingUpdateMode))]
+    [XmlInclude(typeof(TimingCommit))]
+    [XmlInclude(typeof(SpadSwitchDebounce))]
+    [XmlInclude(typeof(LaserStateDebounce))]
+    [XmlInclude(typeof(InterlockLatency))]
+    [XmlInclude(typeof(Diagnostics))]
+    [XmlInclude(typeof(DiagnosticsReset))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(UartTxStats))]
+    [XmlInclude(typeof(EdgeEvents))]
+    [XmlInclude(typeof(EdgeEventsChannels))]
+    [XmlInclude(typeof(EdgeEventsLatency))]
     [Description("Formats a sequence of values as specific LaserDriverController register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -1385,9 +1793,9 @@ namespace Harp.LaserDriverController
     }
 
     /// <summary>
-    /// Represents a register that configure BNCs to start.
+    /// Represents a register that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.
     /// </summary>
-    [Description("Configure BNCs to start")]
+    [Description("Configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends")]
     public partial class BncsState
     {
         /// <summary>
@@ -1482,9 +1890,9 @@ namespace Harp.LaserDriverController
     }
 
     /// <summary>
-    /// Represents a register that configure Signals to start.
+    /// Represents a register that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.
     /// </summary>
-    [Description("Configure Signals to start")]
+    [Description("Configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends")]
     public partial class SignalState
     {
         /// <summary>
@@ -3211,1560 +3619,9372 @@ namespace Harp.LaserDriverController
         }
     }
 
+    /// <summary>
+    /// Represents a register that time ON of BNC1 (microseconds) [10;65535000].
+    /// </summary>
+    [Description("Time ON of BNC1 (microseconds) [10;65535000]")]
+    public partial class Bnc1OnMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1OnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc1OnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc1OnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc1OnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc1OnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc1OnMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1OnMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc1OnMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1OnMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc1OnMicroseconds register.
+    /// </summary>
+    /// <seealso cref="Bnc1OnMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the Bnc1OnMicroseconds register.")]
+    public partial class TimestampedBnc1OnMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1OnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc1OnMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc1OnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Bnc1OnMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time OFF of BNC1 (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [Description("Time OFF of BNC1 (microseconds) 0 or [10;65535000]")]
+    public partial class Bnc1OffMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1OffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc1OffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc1OffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc1OffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc1OffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc1OffMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1OffMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc1OffMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1OffMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc1OffMicroseconds register.
+    /// </summary>
+    /// <seealso cref="Bnc1OffMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the Bnc1OffMicroseconds register.")]
+    public partial class TimestampedBnc1OffMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1OffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc1OffMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc1OffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Bnc1OffMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that wait time to start (microseconds) (BNC1) 0 or [10;65535000].
+    /// </summary>
+    [Description("Wait time to start (microseconds) (BNC1) 0 or [10;65535000]")]
+    public partial class Bnc1TailMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1TailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc1TailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc1TailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc1TailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc1TailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc1TailMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1TailMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc1TailMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1TailMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc1TailMicroseconds register.
+    /// </summary>
+    /// <seealso cref="Bnc1TailMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the Bnc1TailMicroseconds register.")]
+    public partial class TimestampedBnc1TailMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1TailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc1TailMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc1TailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Bnc1TailMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time ON of BNC2 (microseconds) [10;65535000].
+    /// </summary>
+    [Description("Time ON of BNC2 (microseconds) [10;65535000]")]
+    public partial class Bnc2OnMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2OnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc2OnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc2OnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc2OnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc2OnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc2OnMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2OnMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc2OnMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2OnMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc2OnMicroseconds register.
+    /// </summary>
+    /// <seealso cref="Bnc2OnMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the Bnc2OnMicroseconds register.")]
+    public partial class TimestampedBnc2OnMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2OnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc2OnMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc2OnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Bnc2OnMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time OFF of BNC2 (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [Description("Time OFF of BNC2 (microseconds) 0 or [10;65535000]")]
+    public partial class Bnc2OffMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2OffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc2OffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc2OffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc2OffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc2OffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc2OffMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2OffMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc2OffMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2OffMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc2OffMicroseconds register.
+    /// </summary>
+    /// <seealso cref="Bnc2OffMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the Bnc2OffMicroseconds register.")]
+    public partial class TimestampedBnc2OffMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2OffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc2OffMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc2OffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Bnc2OffMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that wait time to start (microseconds) (BNC2) 0 or [10;65535000].
+    /// </summary>
+    [Description("Wait time to start (microseconds) (BNC2) 0 or [10;65535000]")]
+    public partial class Bnc2TailMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2TailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc2TailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc2TailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc2TailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc2TailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc2TailMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2TailMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc2TailMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2TailMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc2TailMicroseconds register.
+    /// </summary>
+    /// <seealso cref="Bnc2TailMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the Bnc2TailMicroseconds register.")]
+    public partial class TimestampedBnc2TailMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2TailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc2TailMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc2TailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Bnc2TailMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time ON of SignalA (microseconds) [10;65535000].
+    /// </summary>
+    [Description("Time ON of SignalA (microseconds) [10;65535000]")]
+    public partial class SignalAOnMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalAOnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalAOnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalAOnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalAOnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalAOnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalAOnMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalAOnMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalAOnMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalAOnMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalAOnMicroseconds register.
+    /// </summary>
+    /// <seealso cref="SignalAOnMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the SignalAOnMicroseconds register.")]
+    public partial class TimestampedSignalAOnMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalAOnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalAOnMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalAOnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return SignalAOnMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time OFF of SignalA (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [Description("Time OFF of SignalA (microseconds) 0 or [10;65535000]")]
+    public partial class SignalAOffMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalAOffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalAOffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalAOffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalAOffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalAOffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalAOffMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalAOffMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalAOffMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalAOffMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalAOffMicroseconds register.
+    /// </summary>
+    /// <seealso cref="SignalAOffMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the SignalAOffMicroseconds register.")]
+    public partial class TimestampedSignalAOffMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalAOffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalAOffMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalAOffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return SignalAOffMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that wait time to start (microseconds) (SignalA) 0 or [10;65535000].
+    /// </summary>
+    [Description("Wait time to start (microseconds) (SignalA) 0 or [10;65535000]")]
+    public partial class SignalATailMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalATailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalATailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalATailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalATailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalATailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalATailMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalATailMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalATailMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalATailMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalATailMicroseconds register.
+    /// </summary>
+    /// <seealso cref="SignalATailMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the SignalATailMicroseconds register.")]
+    public partial class TimestampedSignalATailMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalATailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalATailMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalATailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return SignalATailMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time ON of SignalB (microseconds) [10;65535000].
+    /// </summary>
+    [Description("Time ON of SignalB (microseconds) [10;65535000]")]
+    public partial class SignalBOnMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBOnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalBOnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalBOnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalBOnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalBOnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalBOnMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBOnMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalBOnMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBOnMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalBOnMicroseconds register.
+    /// </summary>
+    /// <seealso cref="SignalBOnMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the SignalBOnMicroseconds register.")]
+    public partial class TimestampedSignalBOnMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBOnMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalBOnMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalBOnMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return SignalBOnMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time OFF of SignalB (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [Description("Time OFF of SignalB (microseconds) 0 or [10;65535000]")]
+    public partial class SignalBOffMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBOffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalBOffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalBOffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalBOffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalBOffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalBOffMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBOffMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalBOffMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBOffMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalBOffMicroseconds register.
+    /// </summary>
+    /// <seealso cref="SignalBOffMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the SignalBOffMicroseconds register.")]
+    public partial class TimestampedSignalBOffMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBOffMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalBOffMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalBOffMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return SignalBOffMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that wait time to start (microseconds) (SignalB) 0 or [10;65535000].
+    /// </summary>
+    [Description("Wait time to start (microseconds) (SignalB) 0 or [10;65535000]")]
+    public partial class SignalBTailMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBTailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalBTailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalBTailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalBTailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalBTailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalBTailMicroseconds"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBTailMicroseconds"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalBTailMicroseconds"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBTailMicroseconds"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalBTailMicroseconds register.
+    /// </summary>
+    /// <seealso cref="SignalBTailMicroseconds"/>
+    [Description("Filters and selects timestamped messages from the SignalBTailMicroseconds register.")]
+    public partial class TimestampedSignalBTailMicroseconds
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBTailMicroseconds"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalBTailMicroseconds.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalBTailMicroseconds"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return SignalBTailMicroseconds.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [Description("Segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class Bnc1Sequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc1Sequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc1Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc1Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc1Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc1Sequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1Sequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc1Sequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1Sequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc1Sequence register.
+    /// </summary>
+    /// <seealso cref="Bnc1Sequence"/>
+    [Description("Filters and selects timestamped messages from the Bnc1Sequence register.")]
+    public partial class TimestampedBnc1Sequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc1Sequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc1Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return Bnc1Sequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [Description("Segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class Bnc2Sequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc2Sequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc2Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc2Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc2Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc2Sequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2Sequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc2Sequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2Sequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc2Sequence register.
+    /// </summary>
+    /// <seealso cref="Bnc2Sequence"/>
+    [Description("Filters and selects timestamped messages from the Bnc2Sequence register.")]
+    public partial class TimestampedBnc2Sequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc2Sequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc2Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return Bnc2Sequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [Description("Segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class SignalASequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalASequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalASequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalASequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalASequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalASequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalASequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalASequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalASequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalASequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalASequence register.
+    /// </summary>
+    /// <seealso cref="SignalASequence"/>
+    [Description("Filters and selects timestamped messages from the SignalASequence register.")]
+    public partial class TimestampedSignalASequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalASequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalASequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalASequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return SignalASequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [Description("Segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class SignalBSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalBSequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalBSequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalBSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalBSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalBSequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBSequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalBSequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBSequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalBSequence register.
+    /// </summary>
+    /// <seealso cref="SignalBSequence"/>
+    [Description("Filters and selects timestamped messages from the SignalBSequence register.")]
+    public partial class TimestampedSignalBSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalBSequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalBSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return SignalBSequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [Description("Number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat")]
+    public partial class SequenceLoops
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceLoops"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceLoops"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceLoops"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceLoops"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceLoops"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceLoops"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceLoops"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceLoops"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceLoops"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceLoops register.
+    /// </summary>
+    /// <seealso cref="SequenceLoops"/>
+    [Description("Filters and selects timestamped messages from the SequenceLoops register.")]
+    public partial class TimestampedSequenceLoops
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceLoops"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceLoops.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceLoops"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return SequenceLoops.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that channels that play their sequence register instead of the ON/OFF pulse train when started.
+    /// </summary>
+    [Description("Channels that play their sequence register instead of the ON/OFF pulse train when started")]
+    public partial class SequenceEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseChannels GetPayload(HarpMessage message)
+        {
+            return (PulseChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PulseChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceEnable register.
+    /// </summary>
+    /// <seealso cref="SequenceEnable"/>
+    [Description("Filters and selects timestamped messages from the SequenceEnable register.")]
+    public partial class TimestampedSequenceEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetPayload(HarpMessage message)
+        {
+            return SequenceEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.
+    /// </summary>
+    [Description("Output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot")]
+    public partial class Pattern
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Pattern"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Pattern"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Pattern"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 128;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Pattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Pattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Pattern"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Pattern"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Pattern"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Pattern"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Pattern register.
+    /// </summary>
+    /// <seealso cref="Pattern"/>
+    [Description("Filters and selects timestamped messages from the Pattern register.")]
+    public partial class TimestampedPattern
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Pattern"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Pattern.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Pattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return Pattern.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of slots of the Pattern register that are played [1;128].
+    /// </summary>
+    [Description("Number of slots of the Pattern register that are played [1;128]")]
+    public partial class PatternLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PatternLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PatternLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PatternLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PatternLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PatternLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PatternLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PatternLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PatternLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PatternLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PatternLength register.
+    /// </summary>
+    /// <seealso cref="PatternLength"/>
+    [Description("Filters and selects timestamped messages from the PatternLength register.")]
+    public partial class TimestampedPatternLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PatternLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PatternLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PatternLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return PatternLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that duration of each pattern slot (microseconds) [1;2000].
+    /// </summary>
+    [Description("Duration of each pattern slot (microseconds) [1;2000]")]
+    public partial class PatternSlot
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PatternSlot"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PatternSlot"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PatternSlot"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PatternSlot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PatternSlot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PatternSlot"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PatternSlot"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PatternSlot"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PatternSlot"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PatternSlot register.
+    /// </summary>
+    /// <seealso cref="PatternSlot"/>
+    [Description("Filters and selects timestamped messages from the PatternSlot register.")]
+    public partial class TimestampedPatternSlot
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PatternSlot"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PatternSlot.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PatternSlot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return PatternSlot.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of times the pattern is played [0;255], 0-> infinite repeat.
+    /// </summary>
+    [Description("Number of times the pattern is played [0;255], 0-> infinite repeat")]
+    public partial class PatternLoops
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PatternLoops"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PatternLoops"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PatternLoops"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PatternLoops"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PatternLoops"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PatternLoops"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PatternLoops"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PatternLoops"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PatternLoops"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PatternLoops register.
+    /// </summary>
+    /// <seealso cref="PatternLoops"/>
+    [Description("Filters and selects timestamped messages from the PatternLoops register.")]
+    public partial class TimestampedPatternLoops
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PatternLoops"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PatternLoops.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PatternLoops"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return PatternLoops.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.
+    /// </summary>
+    [Description("Starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing")]
+    public partial class PatternState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PatternState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PatternState"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PatternState"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PatternState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PatternState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PatternState"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PatternState"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PatternState"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PatternState"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PatternState register.
+    /// </summary>
+    /// <seealso cref="PatternState"/>
+    [Description("Filters and selects timestamped messages from the PatternState register.")]
+    public partial class TimestampedPatternState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PatternState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PatternState.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PatternState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return PatternState.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.
+    /// </summary>
+    [Description("Starts the selected channels on the same timer tick and stops the others. Reads the channels that are running")]
+    public partial class ChannelsState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelsState"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelsState"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelsState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseChannels GetPayload(HarpMessage message)
+        {
+            return (PulseChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelsState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PulseChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelsState"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsState"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelsState"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsState"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelsState register.
+    /// </summary>
+    /// <seealso cref="ChannelsState"/>
+    [Description("Filters and selects timestamped messages from the ChannelsState register.")]
+    public partial class TimestampedChannelsState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelsState.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelsState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetPayload(HarpMessage message)
+        {
+            return ChannelsState.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.
+    /// </summary>
+    [Description("Configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels")]
+    public partial class TriggerMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TriggerMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TriggerMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TriggerMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TriggerMode GetPayload(HarpMessage message)
+        {
+            return (TriggerMode)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TriggerMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TriggerMode> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TriggerMode)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TriggerMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TriggerMode value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TriggerMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TriggerMode value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TriggerMode register.
+    /// </summary>
+    /// <seealso cref="TriggerMode"/>
+    [Description("Filters and selects timestamped messages from the TriggerMode register.")]
+    public partial class TimestampedTriggerMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TriggerMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TriggerMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TriggerMode> GetPayload(HarpMessage message)
+        {
+            return TriggerMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.
+    /// </summary>
+    [Description("Channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby")]
+    public partial class TriggerChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TriggerChannels"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TriggerChannels"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TriggerChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseChannels GetPayload(HarpMessage message)
+        {
+            return (PulseChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TriggerChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PulseChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TriggerChannels"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerChannels"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TriggerChannels"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerChannels"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TriggerChannels register.
+    /// </summary>
+    /// <seealso cref="TriggerChannels"/>
+    [Description("Filters and selects timestamped messages from the TriggerChannels register.")]
+    public partial class TimestampedTriggerChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TriggerChannels.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TriggerChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetPayload(HarpMessage message)
+        {
+            return TriggerChannels.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that harp time of the scheduled start, seconds followed by microseconds [0;999999].
+    /// </summary>
+    [Description("Harp time of the scheduled start, seconds followed by microseconds [0;999999]")]
+    public partial class StartTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StartTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 89;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StartTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StartTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StartTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StartTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StartTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StartTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StartTime register.
+    /// </summary>
+    /// <seealso cref="StartTime"/>
+    [Description("Filters and selects timestamped messages from the StartTime register.")]
+    public partial class TimestampedStartTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StartTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StartTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return StartTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.
+    /// </summary>
+    [Description("Channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start")]
+    public partial class StartTimeChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StartTimeChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 90;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StartTimeChannels"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StartTimeChannels"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StartTimeChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseChannels GetPayload(HarpMessage message)
+        {
+            return (PulseChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StartTimeChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PulseChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StartTimeChannels"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StartTimeChannels"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StartTimeChannels"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StartTimeChannels"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StartTimeChannels register.
+    /// </summary>
+    /// <seealso cref="StartTimeChannels"/>
+    [Description("Filters and selects timestamped messages from the StartTimeChannels register.")]
+    public partial class TimestampedStartTimeChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StartTimeChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StartTimeChannels.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StartTimeChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetPayload(HarpMessage message)
+        {
+            return StartTimeChannels.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.
+    /// </summary>
+    [Description("LaserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse")]
+    public partial class IntensitySequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensitySequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 91;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IntensitySequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IntensitySequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 128;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IntensitySequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IntensitySequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IntensitySequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensitySequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IntensitySequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensitySequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IntensitySequence register.
+    /// </summary>
+    /// <seealso cref="IntensitySequence"/>
+    [Description("Filters and selects timestamped messages from the IntensitySequence register.")]
+    public partial class TimestampedIntensitySequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensitySequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IntensitySequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IntensitySequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return IntensitySequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.
+    /// </summary>
+    [Description("Number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled")]
+    public partial class IntensitySequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensitySequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 92;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IntensitySequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IntensitySequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IntensitySequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IntensitySequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IntensitySequenceLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensitySequenceLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IntensitySequenceLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensitySequenceLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IntensitySequenceLength register.
+    /// </summary>
+    /// <seealso cref="IntensitySequenceLength"/>
+    [Description("Filters and selects timestamped messages from the IntensitySequenceLength register.")]
+    public partial class TimestampedIntensitySequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensitySequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IntensitySequenceLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IntensitySequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return IntensitySequenceLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.
+    /// </summary>
+    [Description("Pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts")]
+    public partial class IntensitySequenceChannel
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensitySequenceChannel"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 93;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IntensitySequenceChannel"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IntensitySequenceChannel"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IntensitySequenceChannel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseChannels GetPayload(HarpMessage message)
+        {
+            return (PulseChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IntensitySequenceChannel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PulseChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IntensitySequenceChannel"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensitySequenceChannel"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IntensitySequenceChannel"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensitySequenceChannel"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IntensitySequenceChannel register.
+    /// </summary>
+    /// <seealso cref="IntensitySequenceChannel"/>
+    [Description("Filters and selects timestamped messages from the IntensitySequenceChannel register.")]
+    public partial class TimestampedIntensitySequenceChannel
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensitySequenceChannel"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IntensitySequenceChannel.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IntensitySequenceChannel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetPayload(HarpMessage message)
+        {
+            return IntensitySequenceChannel.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
+    /// </summary>
+    [Description("Calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them")]
+    public partial class IntensityLutLow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensityLutLow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 94;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IntensityLutLow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IntensityLutLow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 128;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IntensityLutLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IntensityLutLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IntensityLutLow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensityLutLow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IntensityLutLow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensityLutLow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IntensityLutLow register.
+    /// </summary>
+    /// <seealso cref="IntensityLutLow"/>
+    [Description("Filters and selects timestamped messages from the IntensityLutLow register.")]
+    public partial class TimestampedIntensityLutLow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensityLutLow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IntensityLutLow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IntensityLutLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return IntensityLutLow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
+    /// </summary>
+    [Description("Calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them")]
+    public partial class IntensityLutHigh
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensityLutHigh"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 95;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IntensityLutHigh"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IntensityLutHigh"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 128;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IntensityLutHigh"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IntensityLutHigh"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IntensityLutHigh"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensityLutHigh"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IntensityLutHigh"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IntensityLutHigh"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IntensityLutHigh register.
+    /// </summary>
+    /// <seealso cref="IntensityLutHigh"/>
+    [Description("Filters and selects timestamped messages from the IntensityLutHigh register.")]
+    public partial class TimestampedIntensityLutHigh
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IntensityLutHigh"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IntensityLutHigh.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IntensityLutHigh"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return IntensityLutHigh.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.
+    /// </summary>
+    [Description("Sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity")]
+    public partial class LaserPower
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LaserPower"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 96;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LaserPower"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LaserPower"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LaserPower"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LaserPower"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LaserPower"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LaserPower"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LaserPower"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LaserPower"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LaserPower register.
+    /// </summary>
+    /// <seealso cref="LaserPower"/>
+    [Description("Filters and selects timestamped messages from the LaserPower register.")]
+    public partial class TimestampedLaserPower
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LaserPower"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LaserPower.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LaserPower"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return LaserPower.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.
+    /// </summary>
+    [Description("Bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse")]
+    public partial class Bnc1Config
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1Config"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 97;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc1Config"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc1Config"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc1Config"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc1Config"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc1Config"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1Config"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc1Config"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc1Config"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc1Config register.
+    /// </summary>
+    /// <seealso cref="Bnc1Config"/>
+    [Description("Filters and selects timestamped messages from the Bnc1Config register.")]
+    public partial class TimestampedBnc1Config
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc1Config"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc1Config.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc1Config"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Bnc1Config.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.
+    /// </summary>
+    [Description("Bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse")]
+    public partial class Bnc2Config
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2Config"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 98;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Bnc2Config"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Bnc2Config"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Bnc2Config"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Bnc2Config"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Bnc2Config"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2Config"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Bnc2Config"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Bnc2Config"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Bnc2Config register.
+    /// </summary>
+    /// <seealso cref="Bnc2Config"/>
+    [Description("Filters and selects timestamped messages from the Bnc2Config register.")]
+    public partial class TimestampedBnc2Config
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Bnc2Config"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Bnc2Config.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Bnc2Config"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Bnc2Config.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.
+    /// </summary>
+    [Description("SignalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse")]
+    public partial class SignalAConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalAConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 99;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalAConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalAConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalAConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalAConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalAConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalAConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalAConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalAConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalAConfig register.
+    /// </summary>
+    /// <seealso cref="SignalAConfig"/>
+    [Description("Filters and selects timestamped messages from the SignalAConfig register.")]
+    public partial class TimestampedSignalAConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalAConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalAConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalAConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return SignalAConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.
+    /// </summary>
+    [Description("SignalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse")]
+    public partial class SignalBConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 100;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SignalBConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SignalBConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SignalBConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SignalBConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SignalBConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SignalBConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SignalBConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SignalBConfig register.
+    /// </summary>
+    /// <seealso cref="SignalBConfig"/>
+    [Description("Filters and selects timestamped messages from the SignalBConfig register.")]
+    public partial class TimestampedSignalBConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SignalBConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SignalBConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SignalBConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return SignalBConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.
+    /// </summary>
+    [Description("On, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse")]
+    public partial class ChannelsConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 101;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelsConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelsConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelsConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelsConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelsConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelsConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelsConfig register.
+    /// </summary>
+    /// <seealso cref="ChannelsConfig"/>
+    [Description("Filters and selects timestamped messages from the ChannelsConfig register.")]
+    public partial class TimestampedChannelsConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelsConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelsConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ChannelsConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).
+    /// </summary>
+    [Description("Selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged)")]
+    public partial class TimingUpdateMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TimingUpdateMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 102;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TimingUpdateMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TimingUpdateMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TimingUpdateMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TimingUpdateMode GetPayload(HarpMessage message)
+        {
+            return (TimingUpdateMode)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TimingUpdateMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TimingUpdateMode> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TimingUpdateMode)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TimingUpdateMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TimingUpdateMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TimingUpdateMode value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TimingUpdateMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TimingUpdateMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TimingUpdateMode value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TimingUpdateMode register.
+    /// </summary>
+    /// <seealso cref="TimingUpdateMode"/>
+    [Description("Filters and selects timestamped messages from the TimingUpdateMode register.")]
+    public partial class TimestampedTimingUpdateMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TimingUpdateMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TimingUpdateMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TimingUpdateMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TimingUpdateMode> GetPayload(HarpMessage message)
+        {
+            return TimingUpdateMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.
+    /// </summary>
+    [Description("Applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start")]
+    public partial class TimingCommit
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TimingCommit"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 103;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TimingCommit"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TimingCommit"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TimingCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseChannels GetPayload(HarpMessage message)
+        {
+            return (PulseChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TimingCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PulseChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TimingCommit"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TimingCommit"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TimingCommit"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TimingCommit"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TimingCommit register.
+    /// </summary>
+    /// <seealso cref="TimingCommit"/>
+    [Description("Filters and selects timestamped messages from the TimingCommit register.")]
+    public partial class TimestampedTimingCommit
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TimingCommit"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TimingCommit.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TimingCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetPayload(HarpMessage message)
+        {
+            return TimingCommit.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
+    /// </summary>
+    [Description("Debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled")]
+    public partial class SpadSwitchDebounce
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SpadSwitchDebounce"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 104;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SpadSwitchDebounce"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SpadSwitchDebounce"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SpadSwitchDebounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SpadSwitchDebounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SpadSwitchDebounce"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SpadSwitchDebounce"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SpadSwitchDebounce"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SpadSwitchDebounce"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SpadSwitchDebounce register.
+    /// </summary>
+    /// <seealso cref="SpadSwitchDebounce"/>
+    [Description("Filters and selects timestamped messages from the SpadSwitchDebounce register.")]
+    public partial class TimestampedSpadSwitchDebounce
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SpadSwitchDebounce"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SpadSwitchDebounce.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SpadSwitchDebounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SpadSwitchDebounce.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
+    /// </summary>
+    [Description("Debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled")]
+    public partial class LaserStateDebounce
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LaserStateDebounce"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 105;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LaserStateDebounce"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LaserStateDebounce"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LaserStateDebounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LaserStateDebounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LaserStateDebounce"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LaserStateDebounce"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LaserStateDebounce"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LaserStateDebounce"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LaserStateDebounce register.
+    /// </summary>
+    /// <seealso cref="LaserStateDebounce"/>
+    [Description("Filters and selects timestamped messages from the LaserStateDebounce register.")]
+    public partial class TimestampedLaserStateDebounce
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LaserStateDebounce"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LaserStateDebounce.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LaserStateDebounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return LaserStateDebounce.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.
+    /// </summary>
+    [Description("Time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware")]
+    public partial class InterlockLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="InterlockLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 106;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="InterlockLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="InterlockLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="InterlockLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="InterlockLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="InterlockLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="InterlockLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="InterlockLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="InterlockLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// InterlockLatency register.
+    /// </summary>
+    /// <seealso cref="InterlockLatency"/>
+    [Description("Filters and selects timestamped messages from the InterlockLatency register.")]
+    public partial class TimestampedInterlockLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="InterlockLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = InterlockLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="InterlockLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return InterlockLatency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.
+    /// </summary>
+    [Description("Minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order")]
+    public partial class Diagnostics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Diagnostics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 107;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Diagnostics"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Diagnostics"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 15;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Diagnostics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Diagnostics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Diagnostics"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Diagnostics"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Diagnostics"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Diagnostics"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Diagnostics register.
+    /// </summary>
+    /// <seealso cref="Diagnostics"/>
+    [Description("Filters and selects timestamped messages from the Diagnostics register.")]
+    public partial class TimestampedDiagnostics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Diagnostics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Diagnostics.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Diagnostics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Diagnostics.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.
+    /// </summary>
+    [Description("Bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats")]
+    public partial class DiagnosticsReset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DiagnosticsReset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 108;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DiagnosticsReset"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DiagnosticsReset"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DiagnosticsReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DiagnosticsReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DiagnosticsReset"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DiagnosticsReset"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DiagnosticsReset"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DiagnosticsReset"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DiagnosticsReset register.
+    /// </summary>
+    /// <seealso cref="DiagnosticsReset"/>
+    [Description("Filters and selects timestamped messages from the DiagnosticsReset register.")]
+    public partial class TimestampedDiagnosticsReset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DiagnosticsReset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DiagnosticsReset.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DiagnosticsReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DiagnosticsReset.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.
+    /// </summary>
+    [Description("Histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535")]
+    public partial class LatencyHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 109;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LatencyHistogram"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyHistogram"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LatencyHistogram"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyHistogram"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LatencyHistogram register.
+    /// </summary>
+    /// <seealso cref="LatencyHistogram"/>
+    [Description("Filters and selects timestamped messages from the LatencyHistogram register.")]
+    public partial class TimestampedLatencyHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LatencyHistogram.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return LatencyHistogram.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.
+    /// </summary>
+    [Description("Current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them")]
+    public partial class UartTxStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UartTxStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 110;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="UartTxStats"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="UartTxStats"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="UartTxStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="UartTxStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="UartTxStats"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UartTxStats"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="UartTxStats"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UartTxStats"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// UartTxStats register.
+    /// </summary>
+    /// <seealso cref="UartTxStats"/>
+    [Description("Filters and selects timestamped messages from the UartTxStats register.")]
+    public partial class TimestampedUartTxStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UartTxStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = UartTxStats.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="UartTxStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return UartTxStats.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.
+    /// </summary>
+    [Description("Batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF")]
+    public partial class EdgeEvents
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeEvents"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 111;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EdgeEvents"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EdgeEvents"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EdgeEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EdgeEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EdgeEvents"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeEvents"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EdgeEvents"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeEvents"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EdgeEvents register.
+    /// </summary>
+    /// <seealso cref="EdgeEvents"/>
+    [Description("Filters and selects timestamped messages from the EdgeEvents register.")]
+    public partial class TimestampedEdgeEvents
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeEvents"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EdgeEvents.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EdgeEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return EdgeEvents.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.
+    /// </summary>
+    [Description("Channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events")]
+    public partial class EdgeEventsChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeEventsChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 112;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EdgeEventsChannels"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EdgeEventsChannels"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EdgeEventsChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseChannels GetPayload(HarpMessage message)
+        {
+            return (PulseChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EdgeEventsChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PulseChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EdgeEventsChannels"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeEventsChannels"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EdgeEventsChannels"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeEventsChannels"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EdgeEventsChannels register.
+    /// </summary>
+    /// <seealso cref="EdgeEventsChannels"/>
+    [Description("Filters and selects timestamped messages from the EdgeEventsChannels register.")]
+    public partial class TimestampedEdgeEventsChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeEventsChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EdgeEventsChannels.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EdgeEventsChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseChannels> GetPayload(HarpMessage message)
+        {
+            return EdgeEventsChannels.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.
+    /// </summary>
+    [Description("Longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges")]
+    public partial class EdgeEventsLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeEventsLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 113;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EdgeEventsLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EdgeEventsLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EdgeEventsLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EdgeEventsLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EdgeEventsLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeEventsLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EdgeEventsLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeEventsLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EdgeEventsLatency register.
+    /// </summary>
+    /// <seealso cref="EdgeEventsLatency"/>
+    [Description("Filters and selects timestamped messages from the EdgeEventsLatency register.")]
+    public partial class TimestampedEdgeEventsLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeEventsLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EdgeEventsLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EdgeEventsLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return EdgeEventsLatency.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// LaserDriverController device.
     /// </summary>
-    /// <seealso cref="CreateSpadSwitchPayload"/>
-    /// <seealso cref="CreateLaserStatePayload"/>
-    /// <seealso cref="CreateLaserFrequencySelectPayload"/>
-    /// <seealso cref="CreateLaserIntensityPayload"/>
-    /// <seealso cref="CreateOutputSetPayload"/>
-    /// <seealso cref="CreateOutputClearPayload"/>
-    /// <seealso cref="CreateOutputTogglePayload"/>
-    /// <seealso cref="CreateOutputStatePayload"/>
-    /// <seealso cref="CreateBncsStatePayload"/>
-    /// <seealso cref="CreateSignalStatePayload"/>
-    /// <seealso cref="CreateBnc1OnPayload"/>
-    /// <seealso cref="CreateBnc1OffPayload"/>
-    /// <seealso cref="CreateBnc1PulsesPayload"/>
-    /// <seealso cref="CreateBnc1TailPayload"/>
-    /// <seealso cref="CreateBnc2OnPayload"/>
-    /// <seealso cref="CreateBnc2OffPayload"/>
-    /// <seealso cref="CreateBnc2PulsesPayload"/>
-    /// <seealso cref="CreateBnc2TailPayload"/>
-    /// <seealso cref="CreateSignalAOnPayload"/>
-    /// <seealso cref="CreateSignalAOffPayload"/>
-    /// <seealso cref="CreateSignalAPulsesPayload"/>
-    /// <seealso cref="CreateSignalATailPayload"/>
-    /// <seealso cref="CreateSignalBOnPayload"/>
-    /// <seealso cref="CreateSignalBOffPayload"/>
-    /// <seealso cref="CreateSignalBPulsesPayload"/>
-    /// <seealso cref="CreateSignalBTailPayload"/>
-    /// <seealso cref="CreateEventEnablePayload"/>
-    [XmlInclude(typeof(CreateSpadSwitchPayload))]
-    [XmlInclude(typeof(CreateLaserStatePayload))]
-    [XmlInclude(typeof(CreateLaserFrequencySelectPayload))]
-    [XmlInclude(typeof(CreateLaserIntensityPayload))]
-    [XmlInclude(typeof(CreateOutputSetPayload))]
-    [XmlInclude(typeof(CreateOutputClearPayload))]
-    [XmlInclude(typeof(CreateOutputTogglePayload))]
-    [XmlInclude(typeof(CreateOutputStatePayload))]
-    [XmlInclude(typeof(CreateBncsStatePayload))]
-    [XmlInclude(typeof(CreateSignalStatePayload))]
-    [XmlInclude(typeof(CreateBnc1OnPayload))]
-    [XmlInclude(typeof(CreateBnc1OffPayload))]
-    [XmlInclude(typeof(CreateBnc1PulsesPayload))]
-    [XmlInclude(typeof(CreateBnc1TailPayload))]
-    [XmlInclude(typeof(CreateBnc2OnPayload))]
-    [XmlInclude(typeof(CreateBnc2OffPayload))]
-    [XmlInclude(typeof(CreateBnc2PulsesPayload))]
-    [XmlInclude(typeof(CreateBnc2TailPayload))]
-    [XmlInclude(typeof(CreateSignalAOnPayload))]
-    [XmlInclude(typeof(CreateSignalAOffPayload))]
-    [XmlInclude(typeof(CreateSignalAPulsesPayload))]
-    [XmlInclude(typeof(CreateSignalATailPayload))]
-    [XmlInclude(typeof(CreateSignalBOnPayload))]
-    [XmlInclude(typeof(CreateSignalBOffPayload))]
-    [XmlInclude(typeof(CreateSignalBPulsesPayload))]
-    [XmlInclude(typeof(CreateSignalBTailPayload))]
-    [XmlInclude(typeof(CreateEventEnablePayload))]
-    [XmlInclude(typeof(CreateTimestampedSpadSwitchPayload))]
-    [XmlInclude(typeof(CreateTimestampedLaserStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedLaserFrequencySelectPayload))]
-    [XmlInclude(typeof(CreateTimestampedLaserIntensityPayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputTogglePayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedBncsStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedBnc1OnPayload))]
-    [XmlInclude(typeof(CreateTimestampedBnc1OffPayload))]
-    [XmlInclude(typeof(CreateTimestampedBnc1PulsesPayload))]
-    [XmlInclude(typeof(CreateTimestampedBnc1TailPayload))]
-    [XmlInclude(typeof(CreateTimestampedBnc2OnPayload))]
-    [XmlInclude(typeof(CreateTimestampedBnc2OffPayload))]
-    [XmlInclude(typeof(CreateTimestampedBnc2PulsesPayload))]
-    [XmlInclude(typeof(CreateTimestampedBnc2TailPayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalAOnPayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalAOffPayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalAPulsesPayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalATailPayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalBOnPayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalBOffPayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalBPulsesPayload))]
-    [XmlInclude(typeof(CreateTimestampedSignalBTailPayload))]
-    [XmlInclude(typeof(CreateTimestampedEventEnablePayload))]
-    [Description("Creates standard message payloads for the LaserDriverController device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateSpadSwitchPayload"/>
+    /// <seealso cref="CreateLaserStatePayload"/>
+    /// <seealso cref="CreateLaserFrequencySelectPayload"/>
+    /// <seealso cref="CreateLaserIntensityPayload"/>
+    /// <seealso cref="CreateOutputSetPayload"/>
+    /// <seealso cref="CreateOutputClearPayload"/>
+    /// <seealso cref="CreateOutputTogglePayload"/>
+    /// <seealso cref="CreateOutputStatePayload"/>
+    /// <seealso cref="CreateBncsStatePayload"/>
+    /// <seealso cref="CreateSignalStatePayload"/>
+    /// <seealso cref="CreateBnc1OnPayload"/>
+    /// <seealso cref="CreateBnc1OffPayload"/>
+    /// <seealso cref="CreateBnc1PulsesPayload"/>
+    /// <seealso cref="CreateBnc1TailPayload"/>
+    /// <seealso cref="CreateBnc2OnPayload"/>
+    /// <seealso cref="CreateBnc2OffPayload"/>
+    /// <seealso cref="CreateBnc2PulsesPayload"/>
+    /// <seealso cref="CreateBnc2TailPayload"/>
+    /// <seealso cref="CreateSignalAOnPayload"/>
+    /// <seealso cref="CreateSignalAOffPayload"/>
+    /// <seealso cref="CreateSignalAPulsesPayload"/>
+    /// <seealso cref="CreateSignalATailPayload"/>
+    /// <seealso cref="CreateSignalBOnPayload"/>
+    /// <seealso cref="CreateSignalBOffPayload"/>
+    /// <seealso cref="CreateSignalBPulsesPayload"/>
+    /// <seealso cref="CreateSignalBTailPayload"/>
+    /// <seealso cref="CreateEventEnablePayload"/>
+    /// <seealso cref="CreateBnc1OnMicrosecondsPayload"/>
+    /// <seealso cref="CreateBnc1OffMicrosecondsPayload"/>
+    /// <seealso cref="CreateBnc1TailMicrosecondsPayload"/>
+    /// <seealso cref="CreateBnc2OnMicrosecondsPayload"/>
+    /// <seealso cref="CreateBnc2OffMicrosecondsPayload"/>
+    /// <seealso cref="CreateBnc2TailMicrosecondsPayload"/>
+    /// <seealso cref="CreateSignalAOnMicrosecondsPayload"/>
+    /// <seealso cref="CreateSignalAOffMicrosecondsPayload"/>
+    /// <seealso cref="CreateSignalATailMicrosecondsPayload"/>
+    /// <seealso cref="CreateSignalBOnMicrosecondsPayload"/>
+    /// <seealso cref="CreateSignalBOffMicrosecondsPayload"/>
+    /// <seealso cref="CreateSignalBTailMicrosecondsPayload"/>
+    /// <seealso cref="CreateBnc1SequencePayload"/>
+    /// <seealso cref="CreateBnc2SequencePayload"/>
+    /// <seealso cref="CreateSignalASequencePayload"/>
+    /// <seealso cref="CreateSignalBSequencePayload"/>
+    /// <seealso cref="CreateSequenceLoopsPayload"/>
+    /// <seealso cref="CreateSequenceEnablePayload"/>
+    /// <seealso cref="CreatePatternPayload"/>
+    /// <seealso cref="CreatePatternLengthPayload"/>
+    /// <seealso cref="CreatePatternSlotPayload"/>
+    /// <seealso cref="CreatePatternLoopsPayload"/>
+    /// <seealso cref="CreatePatternStatePayload"/>
+    /// <seealso cref="CreateChannelsStatePayload"/>
+    /// <seealso cref="CreateTriggerModePayload"/>
+    /// <seealso cref="CreateTriggerChannelsPayload"/>
+    /// <seealso cref="CreateStartTimePayload"/>
+    /// <seealso cref="CreateStartTimeChannelsPayload"/>
+    /// <seealso cref="CreateIntensitySequencePayload"/>
+    /// <seealso cref="CreateIntensitySequenceLengthPayload"/>
+    /// <seealso cref="CreateIntensitySequenceChannelPayload"/>
+    /// <seealso cref="CreateIntensityLutLowPayload"/>
+    /// <seealso cref="CreateIntensityLutHighPayload"/>
+    /// <seealso cref="CreateLaserPowerPayload"/>
+    /// <seealso cref="CreateBnc1ConfigPayload"/>
+    /// <seealso cref="CreateBnc2ConfigPayload"/>
+    /// <seealso cref="CreateSignalAConfigPayload"/>
+    /// <seealso cref="CreateSignalBConfigPayload"/>
+    /// <seealso cref="CreateChannelsConfigPayload"/>
+    /// <seealso cref="CreateTimingUpdateModePayload"/>
+    /// <seealso cref="CreateTimingCommitPayload"/>
+    /// <seealso cref="CreateSpadSwitchDebouncePayload"/>
+    /// <seealso cref="CreateLaserStateDebouncePayload"/>
+    /// <seealso cref="CreateInterlockLatencyPayload"/>
+    /// <seealso cref="CreateDiagnosticsPayload"/>
+    /// <seealso cref="CreateDiagnosticsResetPayload"/>
+    /// <seealso cref="CreateLatencyHistogramPayload"/>
+    /// <seealso cref="CreateUartTxStatsPayload"/>
+    /// <seealso cref="CreateEdgeEventsPayload"/>
+    /// <seealso cref="CreateEdgeEventsChannelsPayload"/>
+    /// <seealso cref="CreateEdgeEventsLatencyPayload"/>
+    [XmlInclude(typeof(CreateSpadSwitchPayload))]
+    [XmlInclude(typeof(CreateLaserStatePayload))]
+    [XmlInclude(typeof(CreateLaserFrequencySelectPayload))]
+    [XmlInclude(typeof(CreateLaserIntensityPayload))]
+    [XmlInclude(typeof(CreateOutputSetPayload))]
+    [XmlInclude(typeof(CreateOutputClearPayload))]
+    [XmlInclude(typeof(CreateOutputTogglePayload))]
+    [XmlInclude(typeof(CreateOutputStatePayload))]
+    [XmlInclude(typeof(CreateBncsStatePayload))]
+    [XmlInclude(typeof(CreateSignalStatePayload))]
+    [XmlInclude(typeof(CreateBnc1OnPayload))]
+    [XmlInclude(typeof(CreateBnc1OffPayload))]
+    [XmlInclude(typeof(CreateBnc1PulsesPayload))]
+    [XmlInclude(typeof(CreateBnc1TailPayload))]
+    [XmlInclude(typeof(CreateBnc2OnPayload))]
+    [XmlInclude(typeof(CreateBnc2OffPayload))]
+    [XmlInclude(typeof(CreateBnc2PulsesPayload))]
+    [XmlInclude(typeof(CreateBnc2TailPayload))]
+    [XmlInclude(typeof(CreateSignalAOnPayload))]
+    [XmlInclude(typeof(CreateSignalAOffPayload))]
+    [XmlInclude(typeof(CreateSignalAPulsesPayload))]
+    [XmlInclude(typeof(CreateSignalATailPayload))]
+    [XmlInclude(typeof(CreateSignalBOnPayload))]
+    [XmlInclude(typeof(CreateSignalBOffPayload))]
+    [XmlInclude(typeof(CreateSignalBPulsesPayload))]
+    [XmlInclude(typeof(CreateSignalBTailPayload))]
+    [XmlInclude(typeof(CreateEventEnablePayload))]
+    [XmlInclude(typeof(CreateBnc1OnMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateBnc1OffMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateBnc1TailMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateBnc2OnMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateBnc2OffMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateBnc2TailMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateSignalAOnMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateSignalAOffMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateSignalATailMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateSignalBOnMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateSignalBOffMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateSignalBTailMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateBnc1SequencePayload))]
+    [XmlInclude(typeof(CreateBnc2SequencePayload))]
+    [XmlInclude(typeof(CreateSignalASequencePayload))]
+    [XmlInclude(typeof(CreateSignalBSequencePayload))]
+    [XmlInclude(typeof(CreateSequenceLoopsPayload))]
+    [XmlInclude(typeof(CreateSequenceEnablePayload))]
+    [XmlInclude(typeof(CreatePatternPayload))]
+    [XmlInclude(typeof(CreatePatternLengthPayload))]
+    [XmlInclude(typeof(CreatePatternSlotPayload))]
+    [XmlInclude(typeof(CreatePatternLoopsPayload))]
+    [XmlInclude(typeof(CreatePatternStatePayload))]
+    [XmlInclude(typeof(CreateChannelsStatePayload))]
+    [XmlInclude(typeof(CreateTriggerModePayload))]
+    [XmlInclude(typeof(CreateTriggerChannelsPayload))]
+    [XmlInclude(typeof(CreateStartTimePayload))]
+    [XmlInclude(typeof(CreateStartTimeChannelsPayload))]
+    [XmlInclude(typeof(CreateIntensitySequencePayload))]
+    [XmlInclude(typeof(CreateIntensitySequenceLengthPayload))]
+    [XmlInclude(typeof(CreateIntensitySequenceChannelPayload))]
+    [XmlInclude(typeof(CreateIntensityLutLowPayload))]
+    [XmlInclude(typeof(CreateIntensityLutHighPayload))]
+    [XmlInclude(typeof(CreateLaserPowerPayload))]
+    [XmlInclude(typeof(CreateBnc1ConfigPayload))]
+    [XmlInclude(typeof(CreateBnc2ConfigPayload))]
+    [XmlInclude(typeof(CreateSignalAConfigPayload))]
+    [XmlInclude(typeof(CreateSignalBConfigPayload))]
+    [XmlInclude(typeof(CreateChannelsConfigPayload))]
+    [XmlInclude(typeof(CreateTimingUpdateModePayload))]
+    [XmlInclude(typeof(CreateTimingCommitPayload))]
+    [XmlInclude(typeof(CreateSpadSwitchDebouncePayload))]
+    [XmlInclude(typeof(CreateLaserStateDebouncePayload))]
+    [XmlInclude(typeof(CreateInterlockLatencyPayload))]
+    [XmlInclude(typeof(CreateDiagnosticsPayload))]
+    [XmlInclude(typeof(CreateDiagnosticsResetPayload))]
+    [XmlInclude(typeof(CreateLatencyHistogramPayload))]
+    [XmlInclude(typeof(CreateUartTxStatsPayload))]
+    [XmlInclude(typeof(CreateEdgeEventsPayload))]
+    [XmlInclude(typeof(CreateEdgeEventsChannelsPayload))]
+    [XmlInclude(typeof(CreateEdgeEventsLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedSpadSwitchPayload))]
+    [XmlInclude(typeof(CreateTimestampedLaserStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedLaserFrequencySelectPayload))]
+    [XmlInclude(typeof(CreateTimestampedLaserIntensityPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputTogglePayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedBncsStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1OnPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1OffPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1PulsesPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1TailPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2OnPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2OffPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2PulsesPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2TailPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalAOnPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalAOffPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalAPulsesPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalATailPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBOnPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBOffPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBPulsesPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBTailPayload))]
+    [XmlInclude(typeof(CreateTimestampedEventEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1OnMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1OffMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1TailMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2OnMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2OffMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2TailMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalAOnMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalAOffMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalATailMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBOnMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBOffMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBTailMicrosecondsPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1SequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2SequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalASequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBSequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceLoopsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedPatternPayload))]
+    [XmlInclude(typeof(CreateTimestampedPatternLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedPatternSlotPayload))]
+    [XmlInclude(typeof(CreateTimestampedPatternLoopsPayload))]
+    [XmlInclude(typeof(CreateTimestampedPatternStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelsStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerModePayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedStartTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedStartTimeChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedIntensitySequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedIntensitySequenceLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedIntensitySequenceChannelPayload))]
+    [XmlInclude(typeof(CreateTimestampedIntensityLutLowPayload))]
+    [XmlInclude(typeof(CreateTimestampedIntensityLutHighPayload))]
+    [XmlInclude(typeof(CreateTimestampedLaserPowerPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc1ConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedBnc2ConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalAConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedSignalBConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelsConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedTimingUpdateModePayload))]
+    [XmlInclude(typeof(CreateTimestampedTimingCommitPayload))]
+    [XmlInclude(typeof(CreateTimestampedSpadSwitchDebouncePayload))]
+    [XmlInclude(typeof(CreateTimestampedLaserStateDebouncePayload))]
+    [XmlInclude(typeof(CreateTimestampedInterlockLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedDiagnosticsPayload))]
+    [XmlInclude(typeof(CreateTimestampedDiagnosticsResetPayload))]
+    [XmlInclude(typeof(CreateTimestampedLatencyHistogramPayload))]
+    [XmlInclude(typeof(CreateTimestampedUartTxStatsPayload))]
+    [XmlInclude(typeof(CreateTimestampedEdgeEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedEdgeEventsChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedEdgeEventsLatencyPayload))]
+    [Description("Creates standard message payloads for the LaserDriverController device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateSpadSwitchPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(LaserDriverController)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that turns ON/OFF the relay to switch SPADs supply.
+    /// </summary>
+    [DisplayName("SpadSwitchPayload")]
+    [Description("Creates a message payload that turns ON/OFF the relay to switch SPADs supply.")]
+    public partial class CreateSpadSwitchPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that turns ON/OFF the relay to switch SPADs supply.
+        /// </summary>
+        [Description("The value that turns ON/OFF the relay to switch SPADs supply.")]
+        public byte SpadSwitch { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SpadSwitch register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return SpadSwitch;
+        }
+
+        /// <summary>
+        /// Creates a message that turns ON/OFF the relay to switch SPADs supply.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SpadSwitch register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SpadSwitch.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that turns ON/OFF the relay to switch SPADs supply.
+    /// </summary>
+    [DisplayName("TimestampedSpadSwitchPayload")]
+    [Description("Creates a timestamped message payload that turns ON/OFF the relay to switch SPADs supply.")]
+    public partial class CreateTimestampedSpadSwitchPayload : CreateSpadSwitchPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that turns ON/OFF the relay to switch SPADs supply.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SpadSwitch register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SpadSwitch.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that state of the laser, ON/OFF.
+    /// </summary>
+    [DisplayName("LaserStatePayload")]
+    [Description("Creates a message payload that state of the laser, ON/OFF.")]
+    public partial class CreateLaserStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that state of the laser, ON/OFF.
+        /// </summary>
+        [Description("The value that state of the laser, ON/OFF.")]
+        public byte LaserState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LaserState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return LaserState;
+        }
+
+        /// <summary>
+        /// Creates a message that state of the laser, ON/OFF.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LaserState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.LaserState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that state of the laser, ON/OFF.
+    /// </summary>
+    [DisplayName("TimestampedLaserStatePayload")]
+    [Description("Creates a timestamped message payload that state of the laser, ON/OFF.")]
+    public partial class CreateTimestampedLaserStatePayload : CreateLaserStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that state of the laser, ON/OFF.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LaserState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.LaserState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the laser frequency.
+    /// </summary>
+    [DisplayName("LaserFrequencySelectPayload")]
+    [Description("Creates a message payload that set the laser frequency.")]
+    public partial class CreateLaserFrequencySelectPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the laser frequency.
+        /// </summary>
+        [Description("The value that set the laser frequency.")]
+        public FrequencySelect LaserFrequencySelect { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LaserFrequencySelect register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public FrequencySelect GetPayload()
+        {
+            return LaserFrequencySelect;
+        }
+
+        /// <summary>
+        /// Creates a message that set the laser frequency.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LaserFrequencySelect register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.LaserFrequencySelect.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the laser frequency.
+    /// </summary>
+    [DisplayName("TimestampedLaserFrequencySelectPayload")]
+    [Description("Creates a timestamped message payload that set the laser frequency.")]
+    public partial class CreateTimestampedLaserFrequencySelectPayload : CreateLaserFrequencySelectPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the laser frequency.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LaserFrequencySelect register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.LaserFrequencySelect.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that laser intensity value [0:255].
+    /// </summary>
+    [DisplayName("LaserIntensityPayload")]
+    [Description("Creates a message payload that laser intensity value [0:255].")]
+    public partial class CreateLaserIntensityPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that laser intensity value [0:255].
+        /// </summary>
+        [Description("The value that laser intensity value [0:255].")]
+        public byte LaserIntensity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LaserIntensity register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return LaserIntensity;
+        }
+
+        /// <summary>
+        /// Creates a message that laser intensity value [0:255].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LaserIntensity register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.LaserIntensity.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that laser intensity value [0:255].
+    /// </summary>
+    [DisplayName("TimestampedLaserIntensityPayload")]
+    [Description("Creates a timestamped message payload that laser intensity value [0:255].")]
+    public partial class CreateTimestampedLaserIntensityPayload : CreateLaserIntensityPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that laser intensity value [0:255].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LaserIntensity register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.LaserIntensity.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("OutputSetPayload")]
+    [Description("Creates a message payload that set the specified digital output lines.")]
+    public partial class CreateOutputSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the specified digital output lines.
+        /// </summary>
+        [Description("The value that set the specified digital output lines.")]
+        public DigitalOutputs OutputSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputSet;
+        }
+
+        /// <summary>
+        /// Creates a message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.OutputSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputSetPayload")]
+    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
+    public partial class CreateTimestampedOutputSetPayload : CreateOutputSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.OutputSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("OutputClearPayload")]
+    [Description("Creates a message payload that clear the specified digital output lines.")]
+    public partial class CreateOutputClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clear the specified digital output lines.
+        /// </summary>
+        [Description("The value that clear the specified digital output lines.")]
+        public DigitalOutputs OutputClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.OutputClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputClearPayload")]
+    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
+    public partial class CreateTimestampedOutputClearPayload : CreateOutputClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.OutputClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that toggle the specified digital output lines.
+    /// </summary>
+    [DisplayName("OutputTogglePayload")]
+    [Description("Creates a message payload that toggle the specified digital output lines.")]
+    public partial class CreateOutputTogglePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that toggle the specified digital output lines.
+        /// </summary>
+        [Description("The value that toggle the specified digital output lines.")]
+        public DigitalOutputs OutputToggle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputToggle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputToggle;
+        }
+
+        /// <summary>
+        /// Creates a message that toggle the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputToggle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.OutputToggle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that toggle the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputTogglePayload")]
+    [Description("Creates a timestamped message payload that toggle the specified digital output lines.")]
+    public partial class CreateTimestampedOutputTogglePayload : CreateOutputTogglePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that toggle the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputToggle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.OutputToggle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all digital output lines.
+    /// </summary>
+    [DisplayName("OutputStatePayload")]
+    [Description("Creates a message payload that write the state of all digital output lines.")]
+    public partial class CreateOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all digital output lines.
+        /// </summary>
+        [Description("The value that write the state of all digital output lines.")]
+        public DigitalOutputs OutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.OutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all digital output lines.")]
+    public partial class CreateTimestampedOutputStatePayload : CreateOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.OutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.
+    /// </summary>
+    [DisplayName("BncsStatePayload")]
+    [Description("Creates a message payload that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.")]
+    public partial class CreateBncsStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.
+        /// </summary>
+        [Description("The value that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.")]
+        public Bncs BncsState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the BncsState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Bncs GetPayload()
+        {
+            return BncsState;
+        }
+
+        /// <summary>
+        /// Creates a message that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BncsState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.BncsState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.
+    /// </summary>
+    [DisplayName("TimestampedBncsStatePayload")]
+    [Description("Creates a timestamped message payload that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.")]
+    public partial class CreateTimestampedBncsStatePayload : CreateBncsStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configure BNCs to start. With EventBncsState enabled, an event is sent when a BNC starts and when its train ends.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BncsState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.BncsState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.
+    /// </summary>
+    [DisplayName("SignalStatePayload")]
+    [Description("Creates a message payload that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.")]
+    public partial class CreateSignalStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.
+        /// </summary>
+        [Description("The value that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.")]
+        public Signals SignalState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Signals GetPayload()
+        {
+            return SignalState;
+        }
+
+        /// <summary>
+        /// Creates a message that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.
+    /// </summary>
+    [DisplayName("TimestampedSignalStatePayload")]
+    [Description("Creates a timestamped message payload that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.")]
+    public partial class CreateTimestampedSignalStatePayload : CreateSignalStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configure Signals to start. With EventSignalState enabled, an event is sent when a Signal starts and when its train ends.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time ON of BNC1 (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("Bnc1OnPayload")]
+    [Description("Creates a message payload that time ON of BNC1 (milliseconds) [1:65535].")]
+    public partial class CreateBnc1OnPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time ON of BNC1 (milliseconds) [1:65535].
+        /// </summary>
+        [Description("The value that time ON of BNC1 (milliseconds) [1:65535].")]
+        public ushort Bnc1On { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc1On register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Bnc1On;
+        }
+
+        /// <summary>
+        /// Creates a message that time ON of BNC1 (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc1On register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1On.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time ON of BNC1 (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("TimestampedBnc1OnPayload")]
+    [Description("Creates a timestamped message payload that time ON of BNC1 (milliseconds) [1:65535].")]
+    public partial class CreateTimestampedBnc1OnPayload : CreateBnc1OnPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time ON of BNC1 (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc1On register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1On.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time OFF of BNC1 (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("Bnc1OffPayload")]
+    [Description("Creates a message payload that time OFF of BNC1 (milliseconds) [1:65535].")]
+    public partial class CreateBnc1OffPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time OFF of BNC1 (milliseconds) [1:65535].
+        /// </summary>
+        [Description("The value that time OFF of BNC1 (milliseconds) [1:65535].")]
+        public ushort Bnc1Off { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc1Off register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Bnc1Off;
+        }
+
+        /// <summary>
+        /// Creates a message that time OFF of BNC1 (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc1Off register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1Off.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time OFF of BNC1 (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("TimestampedBnc1OffPayload")]
+    [Description("Creates a timestamped message payload that time OFF of BNC1 (milliseconds) [1:65535].")]
+    public partial class CreateTimestampedBnc1OffPayload : CreateBnc1OffPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time OFF of BNC1 (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc1Off register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1Off.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("Bnc1PulsesPayload")]
+    [Description("Creates a message payload that number of pulses (BNC1) [0;65535], 0-> infinite repeat.")]
+    public partial class CreateBnc1PulsesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        [Description("The value that number of pulses (BNC1) [0;65535], 0-> infinite repeat.")]
+        public ushort Bnc1Pulses { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc1Pulses register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Bnc1Pulses;
+        }
+
+        /// <summary>
+        /// Creates a message that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc1Pulses register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1Pulses.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("TimestampedBnc1PulsesPayload")]
+    [Description("Creates a timestamped message payload that number of pulses (BNC1) [0;65535], 0-> infinite repeat.")]
+    public partial class CreateTimestampedBnc1PulsesPayload : CreateBnc1PulsesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc1Pulses register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1Pulses.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that wait time to start (milliseconds) (BNC1) [1;65535].
+    /// </summary>
+    [DisplayName("Bnc1TailPayload")]
+    [Description("Creates a message payload that wait time to start (milliseconds) (BNC1) [1;65535].")]
+    public partial class CreateBnc1TailPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that wait time to start (milliseconds) (BNC1) [1;65535].
+        /// </summary>
+        [Description("The value that wait time to start (milliseconds) (BNC1) [1;65535].")]
+        public ushort Bnc1Tail { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc1Tail register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Bnc1Tail;
+        }
+
+        /// <summary>
+        /// Creates a message that wait time to start (milliseconds) (BNC1) [1;65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc1Tail register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1Tail.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that wait time to start (milliseconds) (BNC1) [1;65535].
+    /// </summary>
+    [DisplayName("TimestampedBnc1TailPayload")]
+    [Description("Creates a timestamped message payload that wait time to start (milliseconds) (BNC1) [1;65535].")]
+    public partial class CreateTimestampedBnc1TailPayload : CreateBnc1TailPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that wait time to start (milliseconds) (BNC1) [1;65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc1Tail register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1Tail.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time ON of BNC2 (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("Bnc2OnPayload")]
+    [Description("Creates a message payload that time ON of BNC2 (milliseconds) [1:65535].")]
+    public partial class CreateBnc2OnPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time ON of BNC2 (milliseconds) [1:65535].
+        /// </summary>
+        [Description("The value that time ON of BNC2 (milliseconds) [1:65535].")]
+        public ushort Bnc2On { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc2On register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Bnc2On;
+        }
+
+        /// <summary>
+        /// Creates a message that time ON of BNC2 (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc2On register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2On.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time ON of BNC2 (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("TimestampedBnc2OnPayload")]
+    [Description("Creates a timestamped message payload that time ON of BNC2 (milliseconds) [1:65535].")]
+    public partial class CreateTimestampedBnc2OnPayload : CreateBnc2OnPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time ON of BNC2 (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc2On register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2On.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time OFF of BNC2 (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("Bnc2OffPayload")]
+    [Description("Creates a message payload that time OFF of BNC2 (milliseconds) [1:65535].")]
+    public partial class CreateBnc2OffPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time OFF of BNC2 (milliseconds) [1:65535].
+        /// </summary>
+        [Description("The value that time OFF of BNC2 (milliseconds) [1:65535].")]
+        public ushort Bnc2Off { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc2Off register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Bnc2Off;
+        }
+
+        /// <summary>
+        /// Creates a message that time OFF of BNC2 (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc2Off register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2Off.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time OFF of BNC2 (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("TimestampedBnc2OffPayload")]
+    [Description("Creates a timestamped message payload that time OFF of BNC2 (milliseconds) [1:65535].")]
+    public partial class CreateTimestampedBnc2OffPayload : CreateBnc2OffPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time OFF of BNC2 (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc2Off register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2Off.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("Bnc2PulsesPayload")]
+    [Description("Creates a message payload that number of pulses (BNC2) [0;65535], 0-> infinite repeat.")]
+    public partial class CreateBnc2PulsesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        [Description("The value that number of pulses (BNC2) [0;65535], 0-> infinite repeat.")]
+        public ushort Bnc2Pulses { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc2Pulses register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Bnc2Pulses;
+        }
+
+        /// <summary>
+        /// Creates a message that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc2Pulses register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2Pulses.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("TimestampedBnc2PulsesPayload")]
+    [Description("Creates a timestamped message payload that number of pulses (BNC2) [0;65535], 0-> infinite repeat.")]
+    public partial class CreateTimestampedBnc2PulsesPayload : CreateBnc2PulsesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc2Pulses register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2Pulses.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that wait time to start (milliseconds) (BNC2) [1;65535].
+    /// </summary>
+    [DisplayName("Bnc2TailPayload")]
+    [Description("Creates a message payload that wait time to start (milliseconds) (BNC2) [1;65535].")]
+    public partial class CreateBnc2TailPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that wait time to start (milliseconds) (BNC2) [1;65535].
+        /// </summary>
+        [Description("The value that wait time to start (milliseconds) (BNC2) [1;65535].")]
+        public ushort Bnc2Tail { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc2Tail register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Bnc2Tail;
+        }
+
+        /// <summary>
+        /// Creates a message that wait time to start (milliseconds) (BNC2) [1;65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc2Tail register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2Tail.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that wait time to start (milliseconds) (BNC2) [1;65535].
+    /// </summary>
+    [DisplayName("TimestampedBnc2TailPayload")]
+    [Description("Creates a timestamped message payload that wait time to start (milliseconds) (BNC2) [1;65535].")]
+    public partial class CreateTimestampedBnc2TailPayload : CreateBnc2TailPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that wait time to start (milliseconds) (BNC2) [1;65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc2Tail register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2Tail.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time ON of SignalA (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("SignalAOnPayload")]
+    [Description("Creates a message payload that time ON of SignalA (milliseconds) [1:65535].")]
+    public partial class CreateSignalAOnPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time ON of SignalA (milliseconds) [1:65535].
+        /// </summary>
+        [Description("The value that time ON of SignalA (milliseconds) [1:65535].")]
+        public ushort SignalAOn { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalAOn register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SignalAOn;
+        }
+
+        /// <summary>
+        /// Creates a message that time ON of SignalA (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalAOn register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAOn.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time ON of SignalA (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("TimestampedSignalAOnPayload")]
+    [Description("Creates a timestamped message payload that time ON of SignalA (milliseconds) [1:65535].")]
+    public partial class CreateTimestampedSignalAOnPayload : CreateSignalAOnPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time ON of SignalA (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalAOn register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAOn.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time OFF of SignalA (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("SignalAOffPayload")]
+    [Description("Creates a message payload that time OFF of SignalA (milliseconds) [1:65535].")]
+    public partial class CreateSignalAOffPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time OFF of SignalA (milliseconds) [1:65535].
+        /// </summary>
+        [Description("The value that time OFF of SignalA (milliseconds) [1:65535].")]
+        public ushort SignalAOff { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalAOff register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SignalAOff;
+        }
+
+        /// <summary>
+        /// Creates a message that time OFF of SignalA (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalAOff register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAOff.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time OFF of SignalA (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("TimestampedSignalAOffPayload")]
+    [Description("Creates a timestamped message payload that time OFF of SignalA (milliseconds) [1:65535].")]
+    public partial class CreateTimestampedSignalAOffPayload : CreateSignalAOffPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time OFF of SignalA (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalAOff register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAOff.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("SignalAPulsesPayload")]
+    [Description("Creates a message payload that number of pulses (SignalA) [0;65535], 0-> infinite repeat.")]
+    public partial class CreateSignalAPulsesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        [Description("The value that number of pulses (SignalA) [0;65535], 0-> infinite repeat.")]
+        public ushort SignalAPulses { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalAPulses register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SignalAPulses;
+        }
+
+        /// <summary>
+        /// Creates a message that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalAPulses register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAPulses.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("TimestampedSignalAPulsesPayload")]
+    [Description("Creates a timestamped message payload that number of pulses (SignalA) [0;65535], 0-> infinite repeat.")]
+    public partial class CreateTimestampedSignalAPulsesPayload : CreateSignalAPulsesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalAPulses register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAPulses.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that wait time to start (milliseconds) (SignalA) [1;65535].
+    /// </summary>
+    [DisplayName("SignalATailPayload")]
+    [Description("Creates a message payload that wait time to start (milliseconds) (SignalA) [1;65535].")]
+    public partial class CreateSignalATailPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that wait time to start (milliseconds) (SignalA) [1;65535].
+        /// </summary>
+        [Description("The value that wait time to start (milliseconds) (SignalA) [1;65535].")]
+        public ushort SignalATail { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalATail register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SignalATail;
+        }
+
+        /// <summary>
+        /// Creates a message that wait time to start (milliseconds) (SignalA) [1;65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalATail register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalATail.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that wait time to start (milliseconds) (SignalA) [1;65535].
+    /// </summary>
+    [DisplayName("TimestampedSignalATailPayload")]
+    [Description("Creates a timestamped message payload that wait time to start (milliseconds) (SignalA) [1;65535].")]
+    public partial class CreateTimestampedSignalATailPayload : CreateSignalATailPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that wait time to start (milliseconds) (SignalA) [1;65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalATail register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalATail.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time ON of SignalB (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("SignalBOnPayload")]
+    [Description("Creates a message payload that time ON of SignalB (milliseconds) [1:65535].")]
+    public partial class CreateSignalBOnPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time ON of SignalB (milliseconds) [1:65535].
+        /// </summary>
+        [Description("The value that time ON of SignalB (milliseconds) [1:65535].")]
+        public ushort SignalBOn { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalBOn register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SignalBOn;
+        }
+
+        /// <summary>
+        /// Creates a message that time ON of SignalB (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalBOn register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBOn.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time ON of SignalB (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("TimestampedSignalBOnPayload")]
+    [Description("Creates a timestamped message payload that time ON of SignalB (milliseconds) [1:65535].")]
+    public partial class CreateTimestampedSignalBOnPayload : CreateSignalBOnPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time ON of SignalB (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalBOn register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBOn.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time OFF of SignalB (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("SignalBOffPayload")]
+    [Description("Creates a message payload that time OFF of SignalB (milliseconds) [1:65535].")]
+    public partial class CreateSignalBOffPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time OFF of SignalB (milliseconds) [1:65535].
+        /// </summary>
+        [Description("The value that time OFF of SignalB (milliseconds) [1:65535].")]
+        public ushort SignalBOff { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalBOff register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SignalBOff;
+        }
+
+        /// <summary>
+        /// Creates a message that time OFF of SignalB (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalBOff register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBOff.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time OFF of SignalB (milliseconds) [1:65535].
+    /// </summary>
+    [DisplayName("TimestampedSignalBOffPayload")]
+    [Description("Creates a timestamped message payload that time OFF of SignalB (milliseconds) [1:65535].")]
+    public partial class CreateTimestampedSignalBOffPayload : CreateSignalBOffPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time OFF of SignalB (milliseconds) [1:65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalBOff register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBOff.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("SignalBPulsesPayload")]
+    [Description("Creates a message payload that number of pulses (SignalB) [0;65535], 0-> infinite repeat.")]
+    public partial class CreateSignalBPulsesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        [Description("The value that number of pulses (SignalB) [0;65535], 0-> infinite repeat.")]
+        public ushort SignalBPulses { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalBPulses register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SignalBPulses;
+        }
+
+        /// <summary>
+        /// Creates a message that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalBPulses register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBPulses.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("TimestampedSignalBPulsesPayload")]
+    [Description("Creates a timestamped message payload that number of pulses (SignalB) [0;65535], 0-> infinite repeat.")]
+    public partial class CreateTimestampedSignalBPulsesPayload : CreateSignalBPulsesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalBPulses register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBPulses.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that wait time to start (milliseconds) (SignalB) [1;65535].
+    /// </summary>
+    [DisplayName("SignalBTailPayload")]
+    [Description("Creates a message payload that wait time to start (milliseconds) (SignalB) [1;65535].")]
+    public partial class CreateSignalBTailPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that wait time to start (milliseconds) (SignalB) [1;65535].
+        /// </summary>
+        [Description("The value that wait time to start (milliseconds) (SignalB) [1;65535].")]
+        public ushort SignalBTail { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalBTail register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SignalBTail;
+        }
+
+        /// <summary>
+        /// Creates a message that wait time to start (milliseconds) (SignalB) [1;65535].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalBTail register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBTail.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that wait time to start (milliseconds) (SignalB) [1;65535].
+    /// </summary>
+    [DisplayName("TimestampedSignalBTailPayload")]
+    [Description("Creates a timestamped message payload that wait time to start (milliseconds) (SignalB) [1;65535].")]
+    public partial class CreateTimestampedSignalBTailPayload : CreateSignalBTailPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that wait time to start (milliseconds) (SignalB) [1;65535].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalBTail register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBTail.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the active events in the device.
+    /// </summary>
+    [DisplayName("EventEnablePayload")]
+    [Description("Creates a message payload that specifies the active events in the device.")]
+    public partial class CreateEventEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the active events in the device.
+        /// </summary>
+        [Description("The value that specifies the active events in the device.")]
+        public LaserDriverControllerEvents EventEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EventEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LaserDriverControllerEvents GetPayload()
+        {
+            return EventEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the active events in the device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EventEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.EventEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the active events in the device.
+    /// </summary>
+    [DisplayName("TimestampedEventEnablePayload")]
+    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
+    public partial class CreateTimestampedEventEnablePayload : CreateEventEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the active events in the device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EventEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.EventEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time ON of BNC1 (microseconds) [10;65535000].
+    /// </summary>
+    [DisplayName("Bnc1OnMicrosecondsPayload")]
+    [Description("Creates a message payload that time ON of BNC1 (microseconds) [10;65535000].")]
+    public partial class CreateBnc1OnMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time ON of BNC1 (microseconds) [10;65535000].
+        /// </summary>
+        [Description("The value that time ON of BNC1 (microseconds) [10;65535000].")]
+        public uint Bnc1OnMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc1OnMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Bnc1OnMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that time ON of BNC1 (microseconds) [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc1OnMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1OnMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time ON of BNC1 (microseconds) [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedBnc1OnMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that time ON of BNC1 (microseconds) [10;65535000].")]
+    public partial class CreateTimestampedBnc1OnMicrosecondsPayload : CreateBnc1OnMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time ON of BNC1 (microseconds) [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc1OnMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1OnMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time OFF of BNC1 (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("Bnc1OffMicrosecondsPayload")]
+    [Description("Creates a message payload that time OFF of BNC1 (microseconds) 0 or [10;65535000].")]
+    public partial class CreateBnc1OffMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time OFF of BNC1 (microseconds) 0 or [10;65535000].
+        /// </summary>
+        [Description("The value that time OFF of BNC1 (microseconds) 0 or [10;65535000].")]
+        public uint Bnc1OffMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc1OffMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Bnc1OffMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that time OFF of BNC1 (microseconds) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc1OffMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1OffMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time OFF of BNC1 (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedBnc1OffMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that time OFF of BNC1 (microseconds) 0 or [10;65535000].")]
+    public partial class CreateTimestampedBnc1OffMicrosecondsPayload : CreateBnc1OffMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time OFF of BNC1 (microseconds) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc1OffMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1OffMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that wait time to start (microseconds) (BNC1) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("Bnc1TailMicrosecondsPayload")]
+    [Description("Creates a message payload that wait time to start (microseconds) (BNC1) 0 or [10;65535000].")]
+    public partial class CreateBnc1TailMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that wait time to start (microseconds) (BNC1) 0 or [10;65535000].
+        /// </summary>
+        [Description("The value that wait time to start (microseconds) (BNC1) 0 or [10;65535000].")]
+        public uint Bnc1TailMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc1TailMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Bnc1TailMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that wait time to start (microseconds) (BNC1) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc1TailMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1TailMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that wait time to start (microseconds) (BNC1) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedBnc1TailMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that wait time to start (microseconds) (BNC1) 0 or [10;65535000].")]
+    public partial class CreateTimestampedBnc1TailMicrosecondsPayload : CreateBnc1TailMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that wait time to start (microseconds) (BNC1) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc1TailMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1TailMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time ON of BNC2 (microseconds) [10;65535000].
+    /// </summary>
+    [DisplayName("Bnc2OnMicrosecondsPayload")]
+    [Description("Creates a message payload that time ON of BNC2 (microseconds) [10;65535000].")]
+    public partial class CreateBnc2OnMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time ON of BNC2 (microseconds) [10;65535000].
+        /// </summary>
+        [Description("The value that time ON of BNC2 (microseconds) [10;65535000].")]
+        public uint Bnc2OnMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc2OnMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Bnc2OnMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that time ON of BNC2 (microseconds) [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc2OnMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2OnMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time ON of BNC2 (microseconds) [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedBnc2OnMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that time ON of BNC2 (microseconds) [10;65535000].")]
+    public partial class CreateTimestampedBnc2OnMicrosecondsPayload : CreateBnc2OnMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time ON of BNC2 (microseconds) [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc2OnMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2OnMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time OFF of BNC2 (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("Bnc2OffMicrosecondsPayload")]
+    [Description("Creates a message payload that time OFF of BNC2 (microseconds) 0 or [10;65535000].")]
+    public partial class CreateBnc2OffMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time OFF of BNC2 (microseconds) 0 or [10;65535000].
+        /// </summary>
+        [Description("The value that time OFF of BNC2 (microseconds) 0 or [10;65535000].")]
+        public uint Bnc2OffMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc2OffMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Bnc2OffMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that time OFF of BNC2 (microseconds) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc2OffMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2OffMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time OFF of BNC2 (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedBnc2OffMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that time OFF of BNC2 (microseconds) 0 or [10;65535000].")]
+    public partial class CreateTimestampedBnc2OffMicrosecondsPayload : CreateBnc2OffMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time OFF of BNC2 (microseconds) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc2OffMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2OffMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that wait time to start (microseconds) (BNC2) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("Bnc2TailMicrosecondsPayload")]
+    [Description("Creates a message payload that wait time to start (microseconds) (BNC2) 0 or [10;65535000].")]
+    public partial class CreateBnc2TailMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that wait time to start (microseconds) (BNC2) 0 or [10;65535000].
+        /// </summary>
+        [Description("The value that wait time to start (microseconds) (BNC2) 0 or [10;65535000].")]
+        public uint Bnc2TailMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc2TailMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Bnc2TailMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that wait time to start (microseconds) (BNC2) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc2TailMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2TailMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that wait time to start (microseconds) (BNC2) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedBnc2TailMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that wait time to start (microseconds) (BNC2) 0 or [10;65535000].")]
+    public partial class CreateTimestampedBnc2TailMicrosecondsPayload : CreateBnc2TailMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that wait time to start (microseconds) (BNC2) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc2TailMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2TailMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time ON of SignalA (microseconds) [10;65535000].
+    /// </summary>
+    [DisplayName("SignalAOnMicrosecondsPayload")]
+    [Description("Creates a message payload that time ON of SignalA (microseconds) [10;65535000].")]
+    public partial class CreateSignalAOnMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time ON of SignalA (microseconds) [10;65535000].
+        /// </summary>
+        [Description("The value that time ON of SignalA (microseconds) [10;65535000].")]
+        public uint SignalAOnMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalAOnMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return SignalAOnMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that time ON of SignalA (microseconds) [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalAOnMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAOnMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time ON of SignalA (microseconds) [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedSignalAOnMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that time ON of SignalA (microseconds) [10;65535000].")]
+    public partial class CreateTimestampedSignalAOnMicrosecondsPayload : CreateSignalAOnMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time ON of SignalA (microseconds) [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalAOnMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAOnMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time OFF of SignalA (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("SignalAOffMicrosecondsPayload")]
+    [Description("Creates a message payload that time OFF of SignalA (microseconds) 0 or [10;65535000].")]
+    public partial class CreateSignalAOffMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time OFF of SignalA (microseconds) 0 or [10;65535000].
+        /// </summary>
+        [Description("The value that time OFF of SignalA (microseconds) 0 or [10;65535000].")]
+        public uint SignalAOffMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalAOffMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return SignalAOffMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that time OFF of SignalA (microseconds) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalAOffMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAOffMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time OFF of SignalA (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedSignalAOffMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that time OFF of SignalA (microseconds) 0 or [10;65535000].")]
+    public partial class CreateTimestampedSignalAOffMicrosecondsPayload : CreateSignalAOffMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time OFF of SignalA (microseconds) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalAOffMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalAOffMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that wait time to start (microseconds) (SignalA) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("SignalATailMicrosecondsPayload")]
+    [Description("Creates a message payload that wait time to start (microseconds) (SignalA) 0 or [10;65535000].")]
+    public partial class CreateSignalATailMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that wait time to start (microseconds) (SignalA) 0 or [10;65535000].
+        /// </summary>
+        [Description("The value that wait time to start (microseconds) (SignalA) 0 or [10;65535000].")]
+        public uint SignalATailMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalATailMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return SignalATailMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that wait time to start (microseconds) (SignalA) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalATailMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalATailMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that wait time to start (microseconds) (SignalA) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedSignalATailMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that wait time to start (microseconds) (SignalA) 0 or [10;65535000].")]
+    public partial class CreateTimestampedSignalATailMicrosecondsPayload : CreateSignalATailMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that wait time to start (microseconds) (SignalA) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalATailMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalATailMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time ON of SignalB (microseconds) [10;65535000].
+    /// </summary>
+    [DisplayName("SignalBOnMicrosecondsPayload")]
+    [Description("Creates a message payload that time ON of SignalB (microseconds) [10;65535000].")]
+    public partial class CreateSignalBOnMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time ON of SignalB (microseconds) [10;65535000].
+        /// </summary>
+        [Description("The value that time ON of SignalB (microseconds) [10;65535000].")]
+        public uint SignalBOnMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalBOnMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return SignalBOnMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that time ON of SignalB (microseconds) [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalBOnMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBOnMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time ON of SignalB (microseconds) [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedSignalBOnMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that time ON of SignalB (microseconds) [10;65535000].")]
+    public partial class CreateTimestampedSignalBOnMicrosecondsPayload : CreateSignalBOnMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time ON of SignalB (microseconds) [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalBOnMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBOnMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time OFF of SignalB (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("SignalBOffMicrosecondsPayload")]
+    [Description("Creates a message payload that time OFF of SignalB (microseconds) 0 or [10;65535000].")]
+    public partial class CreateSignalBOffMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time OFF of SignalB (microseconds) 0 or [10;65535000].
+        /// </summary>
+        [Description("The value that time OFF of SignalB (microseconds) 0 or [10;65535000].")]
+        public uint SignalBOffMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalBOffMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return SignalBOffMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that time OFF of SignalB (microseconds) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalBOffMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBOffMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time OFF of SignalB (microseconds) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedSignalBOffMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that time OFF of SignalB (microseconds) 0 or [10;65535000].")]
+    public partial class CreateTimestampedSignalBOffMicrosecondsPayload : CreateSignalBOffMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time OFF of SignalB (microseconds) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalBOffMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBOffMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that wait time to start (microseconds) (SignalB) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("SignalBTailMicrosecondsPayload")]
+    [Description("Creates a message payload that wait time to start (microseconds) (SignalB) 0 or [10;65535000].")]
+    public partial class CreateSignalBTailMicrosecondsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that wait time to start (microseconds) (SignalB) 0 or [10;65535000].
+        /// </summary>
+        [Description("The value that wait time to start (microseconds) (SignalB) 0 or [10;65535000].")]
+        public uint SignalBTailMicroseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalBTailMicroseconds register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return SignalBTailMicroseconds;
+        }
+
+        /// <summary>
+        /// Creates a message that wait time to start (microseconds) (SignalB) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalBTailMicroseconds register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBTailMicroseconds.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that wait time to start (microseconds) (SignalB) 0 or [10;65535000].
+    /// </summary>
+    [DisplayName("TimestampedSignalBTailMicrosecondsPayload")]
+    [Description("Creates a timestamped message payload that wait time to start (microseconds) (SignalB) 0 or [10;65535000].")]
+    public partial class CreateTimestampedSignalBTailMicrosecondsPayload : CreateSignalBTailMicrosecondsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that wait time to start (microseconds) (SignalB) 0 or [10;65535000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalBTailMicroseconds register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBTailMicroseconds.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [DisplayName("Bnc1SequencePayload")]
+    [Description("Creates a message payload that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class CreateBnc1SequencePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        [Description("The value that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+        public uint[] Bnc1Sequence { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc1Sequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return Bnc1Sequence;
+        }
+
+        /// <summary>
+        /// Creates a message that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc1Sequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1Sequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [DisplayName("TimestampedBnc1SequencePayload")]
+    [Description("Creates a timestamped message payload that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class CreateTimestampedBnc1SequencePayload : CreateBnc1SequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that segments played by Bnc1 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc1Sequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc1Sequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [DisplayName("Bnc2SequencePayload")]
+    [Description("Creates a message payload that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class CreateBnc2SequencePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        [Description("The value that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+        public uint[] Bnc2Sequence { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Bnc2Sequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return Bnc2Sequence;
+        }
+
+        /// <summary>
+        /// Creates a message that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Bnc2Sequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2Sequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [DisplayName("TimestampedBnc2SequencePayload")]
+    [Description("Creates a timestamped message payload that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class CreateTimestampedBnc2SequencePayload : CreateBnc2SequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that segments played by Bnc2 when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Bnc2Sequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Bnc2Sequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [DisplayName("SignalASequencePayload")]
+    [Description("Creates a message payload that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class CreateSignalASequencePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        [Description("The value that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+        public uint[] SignalASequence { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalASequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return SignalASequence;
+        }
+
+        /// <summary>
+        /// Creates a message that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalASequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalASequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [DisplayName("TimestampedSignalASequencePayload")]
+    [Description("Creates a timestamped message payload that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class CreateTimestampedSignalASequencePayload : CreateSignalASequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that segments played by SignalA when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalASequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalASequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [DisplayName("SignalBSequencePayload")]
+    [Description("Creates a message payload that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class CreateSignalBSequencePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        [Description("The value that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+        public uint[] SignalBSequence { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SignalBSequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return SignalBSequence;
+        }
+
+        /// <summary>
+        /// Creates a message that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SignalBSequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBSequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+    /// </summary>
+    [DisplayName("TimestampedSignalBSequencePayload")]
+    [Description("Creates a timestamped message payload that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.")]
+    public partial class CreateTimestampedSignalBSequencePayload : CreateSignalBSequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that segments played by SignalB when enabled in SequenceEnable. Bit 31 is the level and bits 30:0 the duration (microseconds, 0 or [10;65535000]). The first segment with duration 0 ends the sequence.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SignalBSequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SignalBSequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("SequenceLoopsPayload")]
+    [Description("Creates a message payload that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.")]
+    public partial class CreateSequenceLoopsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.
+        /// </summary>
+        [Description("The value that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.")]
+        public ushort[] SequenceLoops { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceLoops register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return SequenceLoops;
+        }
+
+        /// <summary>
+        /// Creates a message that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceLoops register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SequenceLoops.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.
+    /// </summary>
+    [DisplayName("TimestampedSequenceLoopsPayload")]
+    [Description("Creates a timestamped message payload that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.")]
+    public partial class CreateTimestampedSequenceLoopsPayload : CreateSequenceLoopsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of times the sequence of Bnc1, Bnc2, SignalA and SignalB is played [0;65535], 0-> infinite repeat.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceLoops register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SequenceLoops.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that channels that play their sequence register instead of the ON/OFF pulse train when started.
+    /// </summary>
+    [DisplayName("SequenceEnablePayload")]
+    [Description("Creates a message payload that channels that play their sequence register instead of the ON/OFF pulse train when started.")]
+    public partial class CreateSequenceEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that channels that play their sequence register instead of the ON/OFF pulse train when started.
+        /// </summary>
+        [Description("The value that channels that play their sequence register instead of the ON/OFF pulse train when started.")]
+        public PulseChannels SequenceEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PulseChannels GetPayload()
+        {
+            return SequenceEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that channels that play their sequence register instead of the ON/OFF pulse train when started.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.SequenceEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that channels that play their sequence register instead of the ON/OFF pulse train when started.
+    /// </summary>
+    [DisplayName("TimestampedSequenceEnablePayload")]
+    [Description("Creates a timestamped message payload that channels that play their sequence register instead of the ON/OFF pulse train when started.")]
+    public partial class CreateTimestampedSequenceEnablePayload : CreateSequenceEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that channels that play their sequence register instead of the ON/OFF pulse train when started.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.SequenceEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.
+    /// </summary>
+    [DisplayName("PatternPayload")]
+    [Description("Creates a message payload that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.")]
+    public partial class CreatePatternPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.
+        /// </summary>
+        [Description("The value that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.")]
+        public byte[] Pattern { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Pattern register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return Pattern;
+        }
+
+        /// <summary>
+        /// Creates a message that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Pattern register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.Pattern.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.
+    /// </summary>
+    [DisplayName("TimestampedPatternPayload")]
+    [Description("Creates a timestamped message payload that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.")]
+    public partial class CreateTimestampedPatternPayload : CreatePatternPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that output pattern, one byte per time slot. Each byte is a PulseChannels mask with the channels that are high during the slot.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Pattern register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.Pattern.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of slots of the Pattern register that are played [1;128].
+    /// </summary>
+    [DisplayName("PatternLengthPayload")]
+    [Description("Creates a message payload that number of slots of the Pattern register that are played [1;128].")]
+    public partial class CreatePatternLengthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of slots of the Pattern register that are played [1;128].
+        /// </summary>
+        [Description("The value that number of slots of the Pattern register that are played [1;128].")]
+        public byte PatternLength { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PatternLength register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return PatternLength;
+        }
+
+        /// <summary>
+        /// Creates a message that number of slots of the Pattern register that are played [1;128].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PatternLength register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.PatternLength.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of slots of the Pattern register that are played [1;128].
+    /// </summary>
+    [DisplayName("TimestampedPatternLengthPayload")]
+    [Description("Creates a timestamped message payload that number of slots of the Pattern register that are played [1;128].")]
+    public partial class CreateTimestampedPatternLengthPayload : CreatePatternLengthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of slots of the Pattern register that are played [1;128].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PatternLength register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.PatternLength.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duration of each pattern slot (microseconds) [1;2000].
+    /// </summary>
+    [DisplayName("PatternSlotPayload")]
+    [Description("Creates a message payload that duration of each pattern slot (microseconds) [1;2000].")]
+    public partial class CreatePatternSlotPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Gets or sets the value that duration of each pattern slot (microseconds) [1;2000].
         /// </summary>
-        public CreateMessage()
+        [Description("The value that duration of each pattern slot (microseconds) [1;2000].")]
+        public ushort PatternSlot { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PatternSlot register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
         {
-            Payload = new CreateSpadSwitchPayload();
+            return PatternSlot;
         }
 
-        string INamedElement.Name => $"{nameof(LaserDriverController)}.{GetElementDisplayName(Payload)}";
+        /// <summary>
+        /// Creates a message that duration of each pattern slot (microseconds) [1;2000].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PatternSlot register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.PatternSlot.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duration of each pattern slot (microseconds) [1;2000].
+    /// </summary>
+    [DisplayName("TimestampedPatternSlotPayload")]
+    [Description("Creates a timestamped message payload that duration of each pattern slot (microseconds) [1;2000].")]
+    public partial class CreateTimestampedPatternSlotPayload : CreatePatternSlotPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duration of each pattern slot (microseconds) [1;2000].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PatternSlot register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.PatternSlot.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that turns ON/OFF the relay to switch SPADs supply.
+    /// that number of times the pattern is played [0;255], 0-> infinite repeat.
     /// </summary>
-    [DisplayName("SpadSwitchPayload")]
-    [Description("Creates a message payload that turns ON/OFF the relay to switch SPADs supply.")]
-    public partial class CreateSpadSwitchPayload
+    [DisplayName("PatternLoopsPayload")]
+    [Description("Creates a message payload that number of times the pattern is played [0;255], 0-> infinite repeat.")]
+    public partial class CreatePatternLoopsPayload
     {
         /// <summary>
-        /// Gets or sets the value that turns ON/OFF the relay to switch SPADs supply.
+        /// Gets or sets the value that number of times the pattern is played [0;255], 0-> infinite repeat.
         /// </summary>
-        [Description("The value that turns ON/OFF the relay to switch SPADs supply.")]
-        public byte SpadSwitch { get; set; }
+        [Description("The value that number of times the pattern is played [0;255], 0-> infinite repeat.")]
+        public byte PatternLoops { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SpadSwitch register.
+        /// Creates a message payload for the PatternLoops register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public byte GetPayload()
         {
-            return SpadSwitch;
+            return PatternLoops;
         }
 
         /// <summary>
-        /// Creates a message that turns ON/OFF the relay to switch SPADs supply.
+        /// Creates a message that number of times the pattern is played [0;255], 0-> infinite repeat.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SpadSwitch register.</returns>
+        /// <returns>A new message for the PatternLoops register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SpadSwitch.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.PatternLoops.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that turns ON/OFF the relay to switch SPADs supply.
+    /// that number of times the pattern is played [0;255], 0-> infinite repeat.
     /// </summary>
-    [DisplayName("TimestampedSpadSwitchPayload")]
-    [Description("Creates a timestamped message payload that turns ON/OFF the relay to switch SPADs supply.")]
-    public partial class CreateTimestampedSpadSwitchPayload : CreateSpadSwitchPayload
+    [DisplayName("TimestampedPatternLoopsPayload")]
+    [Description("Creates a timestamped message payload that number of times the pattern is played [0;255], 0-> infinite repeat.")]
+    public partial class CreateTimestampedPatternLoopsPayload : CreatePatternLoopsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that turns ON/OFF the relay to switch SPADs supply.
+        /// Creates a timestamped message that number of times the pattern is played [0;255], 0-> infinite repeat.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SpadSwitch register.</returns>
+        /// <returns>A new timestamped message for the PatternLoops register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SpadSwitch.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.PatternLoops.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that state of the laser, ON/OFF.
+    /// that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.
     /// </summary>
-    [DisplayName("LaserStatePayload")]
-    [Description("Creates a message payload that state of the laser, ON/OFF.")]
-    public partial class CreateLaserStatePayload
+    [DisplayName("PatternStatePayload")]
+    [Description("Creates a message payload that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.")]
+    public partial class CreatePatternStatePayload
     {
         /// <summary>
-        /// Gets or sets the value that state of the laser, ON/OFF.
+        /// Gets or sets the value that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.
         /// </summary>
-        [Description("The value that state of the laser, ON/OFF.")]
-        public byte LaserState { get; set; }
+        [Description("The value that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.")]
+        public byte PatternState { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the LaserState register.
+        /// Creates a message payload for the PatternState register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public byte GetPayload()
         {
-            return LaserState;
+            return PatternState;
         }
 
         /// <summary>
-        /// Creates a message that state of the laser, ON/OFF.
+        /// Creates a message that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the LaserState register.</returns>
+        /// <returns>A new message for the PatternState register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.LaserState.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.PatternState.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that state of the laser, ON/OFF.
+    /// that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.
     /// </summary>
-    [DisplayName("TimestampedLaserStatePayload")]
-    [Description("Creates a timestamped message payload that state of the laser, ON/OFF.")]
-    public partial class CreateTimestampedLaserStatePayload : CreateLaserStatePayload
+    [DisplayName("TimestampedPatternStatePayload")]
+    [Description("Creates a timestamped message payload that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.")]
+    public partial class CreateTimestampedPatternStatePayload : CreatePatternStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts (1) or stops (0) the pattern output. Reads 1 while the pattern is playing.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PatternState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.PatternState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.
+    /// </summary>
+    [DisplayName("ChannelsStatePayload")]
+    [Description("Creates a message payload that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.")]
+    public partial class CreateChannelsStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.
+        /// </summary>
+        [Description("The value that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.")]
+        public PulseChannels ChannelsState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ChannelsState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PulseChannels GetPayload()
+        {
+            return ChannelsState;
+        }
+
+        /// <summary>
+        /// Creates a message that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ChannelsState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.ChannelsState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.
+    /// </summary>
+    [DisplayName("TimestampedChannelsStatePayload")]
+    [Description("Creates a timestamped message payload that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.")]
+    public partial class CreateTimestampedChannelsStatePayload : CreateChannelsStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts the selected channels on the same timer tick and stops the others. Reads the channels that are running.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ChannelsState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.ChannelsState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.
+    /// </summary>
+    [DisplayName("TriggerModePayload")]
+    [Description("Creates a message payload that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.")]
+    public partial class CreateTriggerModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.
+        /// </summary>
+        [Description("The value that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.")]
+        public TriggerMode TriggerMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TriggerMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TriggerMode GetPayload()
+        {
+            return TriggerMode;
+        }
+
+        /// <summary>
+        /// Creates a message that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TriggerMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.TriggerMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.
+    /// </summary>
+    [DisplayName("TimestampedTriggerModePayload")]
+    [Description("Creates a timestamped message payload that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.")]
+    public partial class CreateTimestampedTriggerModePayload : CreateTriggerModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures DO2 as a trigger input and selects the edge that starts the channels in TriggerChannels.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TriggerMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LaserDriverController.TriggerMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.
+    /// </summary>
+    [DisplayName("TriggerChannelsPayload")]
+    [Description("Creates a message payload that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.")]
+    public partial class CreateTriggerChannelsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.
+        /// </summary>
+        [Description("The value that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.")]
+        public PulseChannels TriggerChannels { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TriggerChannels register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PulseChannels GetPayload()
+        {
+            return TriggerChannels;
+        }
+
+        /// <summary>
+        /// Creates a message that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TriggerChannels register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LaserDriverController.TriggerChannels.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.
+    /// </summary>
+    [DisplayName("TimestampedTriggerChannelsPayload")]
+    [Description("Creates a timestamped message payload that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.")]
+    public partial class CreateTimestampedTriggerChannelsPayload : CreateTriggerChannelsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that state of the laser, ON/OFF.
+        /// Creates a timestamped message that channels started by the trigger input. Their timings are loaded from the channel registers each time the trigger fires, and the input is ignored while the device is in standby.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the LaserState register.</returns>
+        /// <returns>A new timestamped message for the TriggerChannels register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.LaserState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.TriggerChannels.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the laser frequency.
+    /// that harp time of the scheduled start, seconds followed by microseconds [0;999999].
     /// </summary>
-    [DisplayName("LaserFrequencySelectPayload")]
-    [Description("Creates a message payload that set the laser frequency.")]
-    public partial class CreateLaserFrequencySelectPayload
+    [DisplayName("StartTimePayload")]
+    [Description("Creates a message payload that harp time of the scheduled start, seconds followed by microseconds [0;999999].")]
+    public partial class CreateStartTimePayload
     {
         /// <summary>
-        /// Gets or sets the value that set the laser frequency.
+        /// Gets or sets the value that harp time of the scheduled start, seconds followed by microseconds [0;999999].
         /// </summary>
-        [Description("The value that set the laser frequency.")]
-        public FrequencySelect LaserFrequencySelect { get; set; }
+        [Description("The value that harp time of the scheduled start, seconds followed by microseconds [0;999999].")]
+        public uint[] StartTime { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the LaserFrequencySelect register.
+        /// Creates a message payload for the StartTime register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public FrequencySelect GetPayload()
+        public uint[] GetPayload()
         {
-            return LaserFrequencySelect;
+            return StartTime;
         }
 
         /// <summary>
-        /// Creates a message that set the laser frequency.
+        /// Creates a message that harp time of the scheduled start, seconds followed by microseconds [0;999999].
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the LaserFrequencySelect register.</returns>
+        /// <returns>A new message for the StartTime register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.LaserFrequencySelect.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.StartTime.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the laser frequency.
+    /// that harp time of the scheduled start, seconds followed by microseconds [0;999999].
     /// </summary>
-    [DisplayName("TimestampedLaserFrequencySelectPayload")]
-    [Description("Creates a timestamped message payload that set the laser frequency.")]
-    public partial class CreateTimestampedLaserFrequencySelectPayload : CreateLaserFrequencySelectPayload
+    [DisplayName("TimestampedStartTimePayload")]
+    [Description("Creates a timestamped message payload that harp time of the scheduled start, seconds followed by microseconds [0;999999].")]
+    public partial class CreateTimestampedStartTimePayload : CreateStartTimePayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the laser frequency.
+        /// Creates a timestamped message that harp time of the scheduled start, seconds followed by microseconds [0;999999].
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the LaserFrequencySelect register.</returns>
+        /// <returns>A new timestamped message for the StartTime register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.LaserFrequencySelect.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.StartTime.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that laser intensity value [0:255].
+    /// that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.
     /// </summary>
-    [DisplayName("LaserIntensityPayload")]
-    [Description("Creates a message payload that laser intensity value [0:255].")]
-    public partial class CreateLaserIntensityPayload
+    [DisplayName("StartTimeChannelsPayload")]
+    [Description("Creates a message payload that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.")]
+    public partial class CreateStartTimeChannelsPayload
     {
         /// <summary>
-        /// Gets or sets the value that laser intensity value [0:255].
+        /// Gets or sets the value that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.
         /// </summary>
-        [Description("The value that laser intensity value [0:255].")]
-        public byte LaserIntensity { get; set; }
+        [Description("The value that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.")]
+        public PulseChannels StartTimeChannels { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the LaserIntensity register.
+        /// Creates a message payload for the StartTimeChannels register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public PulseChannels GetPayload()
         {
-            return LaserIntensity;
+            return StartTimeChannels;
         }
 
         /// <summary>
-        /// Creates a message that laser intensity value [0:255].
+        /// Creates a message that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the LaserIntensity register.</returns>
+        /// <returns>A new message for the StartTimeChannels register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.LaserIntensity.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.StartTimeChannels.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that laser intensity value [0:255].
+    /// that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.
     /// </summary>
-    [DisplayName("TimestampedLaserIntensityPayload")]
-    [Description("Creates a timestamped message payload that laser intensity value [0:255].")]
-    public partial class CreateTimestampedLaserIntensityPayload : CreateLaserIntensityPayload
+    [DisplayName("TimestampedStartTimeChannelsPayload")]
+    [Description("Creates a timestamped message payload that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.")]
+    public partial class CreateTimestampedStartTimeChannelsPayload : CreateStartTimeChannelsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that laser intensity value [0:255].
+        /// Creates a timestamped message that channels started at the time in StartTime, which must be in the future. Their timings are latched on the write. Writing 0 cancels, and the register clears when the channels start.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the LaserIntensity register.</returns>
+        /// <returns>A new timestamped message for the StartTimeChannels register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.LaserIntensity.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.StartTimeChannels.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the specified digital output lines.
+    /// that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.
     /// </summary>
-    [DisplayName("OutputSetPayload")]
-    [Description("Creates a message payload that set the specified digital output lines.")]
-    public partial class CreateOutputSetPayload
+    [DisplayName("IntensitySequencePayload")]
+    [Description("Creates a message payload that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.")]
+    public partial class CreateIntensitySequencePayload
     {
         /// <summary>
-        /// Gets or sets the value that set the specified digital output lines.
+        /// Gets or sets the value that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.
         /// </summary>
-        [Description("The value that set the specified digital output lines.")]
-        public DigitalOutputs OutputSet { get; set; }
+        [Description("The value that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.")]
+        public byte[] IntensitySequence { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputSet register.
+        /// Creates a message payload for the IntensitySequence register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public byte[] GetPayload()
         {
-            return OutputSet;
+            return IntensitySequence;
         }
 
         /// <summary>
-        /// Creates a message that set the specified digital output lines.
+        /// Creates a message that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputSet register.</returns>
+        /// <returns>A new message for the IntensitySequence register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.OutputSet.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.IntensitySequence.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the specified digital output lines.
+    /// that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.
     /// </summary>
-    [DisplayName("TimestampedOutputSetPayload")]
-    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
-    public partial class CreateTimestampedOutputSetPayload : CreateOutputSetPayload
+    [DisplayName("TimestampedIntensitySequencePayload")]
+    [Description("Creates a timestamped message payload that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.")]
+    public partial class CreateTimestampedIntensitySequencePayload : CreateIntensitySequencePayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the specified digital output lines.
+        /// Creates a timestamped message that laserIntensity values played with the channel in IntensitySequenceChannel. The first one is applied when the channel starts and the next one on each of its falling edges, ready for the next pulse.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputSet register.</returns>
+        /// <returns>A new timestamped message for the IntensitySequence register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.OutputSet.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.IntensitySequence.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that clear the specified digital output lines.
+    /// that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.
     /// </summary>
-    [DisplayName("OutputClearPayload")]
-    [Description("Creates a message payload that clear the specified digital output lines.")]
-    public partial class CreateOutputClearPayload
+    [DisplayName("IntensitySequenceLengthPayload")]
+    [Description("Creates a message payload that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.")]
+    public partial class CreateIntensitySequenceLengthPayload
     {
         /// <summary>
-        /// Gets or sets the value that clear the specified digital output lines.
+        /// Gets or sets the value that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.
         /// </summary>
-        [Description("The value that clear the specified digital output lines.")]
-        public DigitalOutputs OutputClear { get; set; }
+        [Description("The value that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.")]
+        public byte IntensitySequenceLength { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputClear register.
+        /// Creates a message payload for the IntensitySequenceLength register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public byte GetPayload()
         {
-            return OutputClear;
+            return IntensitySequenceLength;
         }
 
         /// <summary>
-        /// Creates a message that clear the specified digital output lines.
+        /// Creates a message that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputClear register.</returns>
+        /// <returns>A new message for the IntensitySequenceLength register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.OutputClear.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.IntensitySequenceLength.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that clear the specified digital output lines.
+    /// that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.
     /// </summary>
-    [DisplayName("TimestampedOutputClearPayload")]
-    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
-    public partial class CreateTimestampedOutputClearPayload : CreateOutputClearPayload
+    [DisplayName("TimestampedIntensitySequenceLengthPayload")]
+    [Description("Creates a timestamped message payload that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.")]
+    public partial class CreateTimestampedIntensitySequenceLengthPayload : CreateIntensitySequenceLengthPayload
     {
         /// <summary>
-        /// Creates a timestamped message that clear the specified digital output lines.
+        /// Creates a timestamped message that number of values of IntensitySequence played before wrapping around to the first one [0;128], 0 -> disabled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputClear register.</returns>
+        /// <returns>A new timestamped message for the IntensitySequenceLength register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.OutputClear.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.IntensitySequenceLength.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that toggle the specified digital output lines.
+    /// that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.
     /// </summary>
-    [DisplayName("OutputTogglePayload")]
-    [Description("Creates a message payload that toggle the specified digital output lines.")]
-    public partial class CreateOutputTogglePayload
+    [DisplayName("IntensitySequenceChannelPayload")]
+    [Description("Creates a message payload that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.")]
+    public partial class CreateIntensitySequenceChannelPayload
     {
         /// <summary>
-        /// Gets or sets the value that toggle the specified digital output lines.
+        /// Gets or sets the value that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.
         /// </summary>
-        [Description("The value that toggle the specified digital output lines.")]
-        public DigitalOutputs OutputToggle { get; set; }
+        [Description("The value that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.")]
+        public PulseChannels IntensitySequenceChannel { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputToggle register.
+        /// Creates a message payload for the IntensitySequenceChannel register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public PulseChannels GetPayload()
         {
-            return OutputToggle;
+            return IntensitySequenceChannel;
         }
 
         /// <summary>
-        /// Creates a message that toggle the specified digital output lines.
+        /// Creates a message that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputToggle register.</returns>
+        /// <returns>A new message for the IntensitySequenceChannel register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.OutputToggle.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.IntensitySequenceChannel.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that toggle the specified digital output lines.
+    /// that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.
     /// </summary>
-    [DisplayName("TimestampedOutputTogglePayload")]
-    [Description("Creates a timestamped message payload that toggle the specified digital output lines.")]
-    public partial class CreateTimestampedOutputTogglePayload : CreateOutputTogglePayload
+    [DisplayName("TimestampedIntensitySequenceChannelPayload")]
+    [Description("Creates a timestamped message payload that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.")]
+    public partial class CreateTimestampedIntensitySequenceChannelPayload : CreateIntensitySequenceChannelPayload
     {
         /// <summary>
-        /// Creates a timestamped message that toggle the specified digital output lines.
+        /// Creates a timestamped message that pulse channel whose edges step IntensitySequence, a single channel or 0 to disable. Taken when the channel starts.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputToggle register.</returns>
+        /// <returns>A new timestamped message for the IntensitySequenceChannel register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.OutputToggle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.IntensitySequenceChannel.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that write the state of all digital output lines.
+    /// that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
     /// </summary>
-    [DisplayName("OutputStatePayload")]
-    [Description("Creates a message payload that write the state of all digital output lines.")]
-    public partial class CreateOutputStatePayload
+    [DisplayName("IntensityLutLowPayload")]
+    [Description("Creates a message payload that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.")]
+    public partial class CreateIntensityLutLowPayload
     {
         /// <summary>
-        /// Gets or sets the value that write the state of all digital output lines.
+        /// Gets or sets the value that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
         /// </summary>
-        [Description("The value that write the state of all digital output lines.")]
-        public DigitalOutputs OutputState { get; set; }
+        [Description("The value that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.")]
+        public byte[] IntensityLutLow { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputState register.
+        /// Creates a message payload for the IntensityLutLow register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public byte[] GetPayload()
         {
-            return OutputState;
+            return IntensityLutLow;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all digital output lines.
+        /// Creates a message that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputState register.</returns>
+        /// <returns>A new message for the IntensityLutLow register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.OutputState.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.IntensityLutLow.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all digital output lines.
+    /// that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
     /// </summary>
-    [DisplayName("TimestampedOutputStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all digital output lines.")]
-    public partial class CreateTimestampedOutputStatePayload : CreateOutputStatePayload
+    [DisplayName("TimestampedIntensityLutLowPayload")]
+    [Description("Creates a timestamped message payload that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.")]
+    public partial class CreateTimestampedIntensityLutLowPayload : CreateIntensityLutLowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all digital output lines.
+        /// Creates a timestamped message that calibration table, LaserIntensity applied for each LaserPower value from 0 to 127. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputState register.</returns>
+        /// <returns>A new timestamped message for the IntensityLutLow register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.OutputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.IntensityLutLow.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configure BNCs to start.
+    /// that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
     /// </summary>
-    [DisplayName("BncsStatePayload")]
-    [Description("Creates a message payload that configure BNCs to start.")]
-    public partial class CreateBncsStatePayload
+    [DisplayName("IntensityLutHighPayload")]
+    [Description("Creates a message payload that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.")]
+    public partial class CreateIntensityLutHighPayload
     {
         /// <summary>
-        /// Gets or sets the value that configure BNCs to start.
+        /// Gets or sets the value that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
         /// </summary>
-        [Description("The value that configure BNCs to start.")]
-        public Bncs BncsState { get; set; }
+        [Description("The value that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.")]
+        public byte[] IntensityLutHigh { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the BncsState register.
+        /// Creates a message payload for the IntensityLutHigh register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Bncs GetPayload()
+        public byte[] GetPayload()
         {
-            return BncsState;
+            return IntensityLutHigh;
         }
 
         /// <summary>
-        /// Creates a message that configure BNCs to start.
+        /// Creates a message that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the BncsState register.</returns>
+        /// <returns>A new message for the IntensityLutHigh register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.BncsState.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.IntensityLutHigh.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configure BNCs to start.
+    /// that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
     /// </summary>
-    [DisplayName("TimestampedBncsStatePayload")]
-    [Description("Creates a timestamped message payload that configure BNCs to start.")]
-    public partial class CreateTimestampedBncsStatePayload : CreateBncsStatePayload
+    [DisplayName("TimestampedIntensityLutHighPayload")]
+    [Description("Creates a timestamped message payload that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.")]
+    public partial class CreateTimestampedIntensityLutHighPayload : CreateIntensityLutHighPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configure BNCs to start.
+        /// Creates a timestamped message that calibration table, LaserIntensity applied for each LaserPower value from 128 to 255. Saved to non-volatile memory with the other registers and reset to identity (LaserIntensity = LaserPower) with them.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the BncsState register.</returns>
+        /// <returns>A new timestamped message for the IntensityLutHigh register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.BncsState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.IntensityLutHigh.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configure Signals to start.
+    /// that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.
     /// </summary>
-    [DisplayName("SignalStatePayload")]
-    [Description("Creates a message payload that configure Signals to start.")]
-    public partial class CreateSignalStatePayload
+    [DisplayName("LaserPowerPayload")]
+    [Description("Creates a message payload that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.")]
+    public partial class CreateLaserPowerPayload
     {
         /// <summary>
-        /// Gets or sets the value that configure Signals to start.
+        /// Gets or sets the value that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.
         /// </summary>
-        [Description("The value that configure Signals to start.")]
-        public Signals SignalState { get; set; }
+        [Description("The value that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.")]
+        public byte LaserPower { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalState register.
+        /// Creates a message payload for the LaserPower register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Signals GetPayload()
+        public byte GetPayload()
         {
-            return SignalState;
+            return LaserPower;
         }
 
         /// <summary>
-        /// Creates a message that configure Signals to start.
+        /// Creates a message that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalState register.</returns>
+        /// <returns>A new message for the LaserPower register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalState.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.LaserPower.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configure Signals to start.
+    /// that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.
     /// </summary>
-    [DisplayName("TimestampedSignalStatePayload")]
-    [Description("Creates a timestamped message payload that configure Signals to start.")]
-    public partial class CreateTimestampedSignalStatePayload : CreateSignalStatePayload
+    [DisplayName("TimestampedLaserPowerPayload")]
+    [Description("Creates a timestamped message payload that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.")]
+    public partial class CreateTimestampedLaserPowerPayload : CreateLaserPowerPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configure Signals to start.
+        /// Creates a timestamped message that sets the laser power [0;255]. The digipot value is taken from IntensityLutLow and IntensityLutHigh and can be read in LaserIntensity.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalState register.</returns>
+        /// <returns>A new timestamped message for the LaserPower register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.LaserPower.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time ON of BNC1 (milliseconds) [1:65535].
+    /// that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.
     /// </summary>
-    [DisplayName("Bnc1OnPayload")]
-    [Description("Creates a message payload that time ON of BNC1 (milliseconds) [1:65535].")]
-    public partial class CreateBnc1OnPayload
+    [DisplayName("Bnc1ConfigPayload")]
+    [Description("Creates a message payload that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.")]
+    public partial class CreateBnc1ConfigPayload
     {
         /// <summary>
-        /// Gets or sets the value that time ON of BNC1 (milliseconds) [1:65535].
+        /// Gets or sets the value that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
-        [Description("The value that time ON of BNC1 (milliseconds) [1:65535].")]
-        public ushort Bnc1On { get; set; }
+        [Description("The value that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.")]
+        public ushort[] Bnc1Config { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Bnc1On register.
+        /// Creates a message payload for the Bnc1Config register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return Bnc1On;
+            return Bnc1Config;
         }
 
         /// <summary>
-        /// Creates a message that time ON of BNC1 (milliseconds) [1:65535].
+        /// Creates a message that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Bnc1On register.</returns>
+        /// <returns>A new message for the Bnc1Config register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc1On.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.Bnc1Config.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time ON of BNC1 (milliseconds) [1:65535].
+    /// that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.
     /// </summary>
-    [DisplayName("TimestampedBnc1OnPayload")]
-    [Description("Creates a timestamped message payload that time ON of BNC1 (milliseconds) [1:65535].")]
-    public partial class CreateTimestampedBnc1OnPayload : CreateBnc1OnPayload
+    [DisplayName("TimestampedBnc1ConfigPayload")]
+    [Description("Creates a timestamped message payload that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.")]
+    public partial class CreateTimestampedBnc1ConfigPayload : CreateBnc1ConfigPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time ON of BNC1 (milliseconds) [1:65535].
+        /// Creates a timestamped message that bnc1On, Bnc1Off, Bnc1Pulses and Bnc1Tail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Bnc1On register.</returns>
+        /// <returns>A new timestamped message for the Bnc1Config register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc1On.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.Bnc1Config.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time OFF of BNC1 (milliseconds) [1:65535].
+    /// that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.
     /// </summary>
-    [DisplayName("Bnc1OffPayload")]
-    [Description("Creates a message payload that time OFF of BNC1 (milliseconds) [1:65535].")]
-    public partial class CreateBnc1OffPayload
+    [DisplayName("Bnc2ConfigPayload")]
+    [Description("Creates a message payload that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.")]
+    public partial class CreateBnc2ConfigPayload
     {
         /// <summary>
-        /// Gets or sets the value that time OFF of BNC1 (milliseconds) [1:65535].
+        /// Gets or sets the value that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
-        [Description("The value that time OFF of BNC1 (milliseconds) [1:65535].")]
-        public ushort Bnc1Off { get; set; }
+        [Description("The value that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.")]
+        public ushort[] Bnc2Config { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Bnc1Off register.
+        /// Creates a message payload for the Bnc2Config register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return Bnc1Off;
+            return Bnc2Config;
         }
 
         /// <summary>
-        /// Creates a message that time OFF of BNC1 (milliseconds) [1:65535].
+        /// Creates a message that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Bnc1Off register.</returns>
+        /// <returns>A new message for the Bnc2Config register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc1Off.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.Bnc2Config.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time OFF of BNC1 (milliseconds) [1:65535].
+    /// that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.
     /// </summary>
-    [DisplayName("TimestampedBnc1OffPayload")]
-    [Description("Creates a timestamped message payload that time OFF of BNC1 (milliseconds) [1:65535].")]
-    public partial class CreateTimestampedBnc1OffPayload : CreateBnc1OffPayload
+    [DisplayName("TimestampedBnc2ConfigPayload")]
+    [Description("Creates a timestamped message payload that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.")]
+    public partial class CreateTimestampedBnc2ConfigPayload : CreateBnc2ConfigPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time OFF of BNC1 (milliseconds) [1:65535].
+        /// Creates a timestamped message that bnc2On, Bnc2Off, Bnc2Pulses and Bnc2Tail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Bnc1Off register.</returns>
+        /// <returns>A new timestamped message for the Bnc2Config register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc1Off.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.Bnc2Config.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+    /// that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.
     /// </summary>
-    [DisplayName("Bnc1PulsesPayload")]
-    [Description("Creates a message payload that number of pulses (BNC1) [0;65535], 0-> infinite repeat.")]
-    public partial class CreateBnc1PulsesPayload
+    [DisplayName("SignalAConfigPayload")]
+    [Description("Creates a message payload that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.")]
+    public partial class CreateSignalAConfigPayload
     {
         /// <summary>
-        /// Gets or sets the value that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+        /// Gets or sets the value that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
-        [Description("The value that number of pulses (BNC1) [0;65535], 0-> infinite repeat.")]
-        public ushort Bnc1Pulses { get; set; }
+        [Description("The value that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.")]
+        public ushort[] SignalAConfig { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Bnc1Pulses register.
+        /// Creates a message payload for the SignalAConfig register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return Bnc1Pulses;
+            return SignalAConfig;
         }
 
         /// <summary>
-        /// Creates a message that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+        /// Creates a message that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Bnc1Pulses register.</returns>
+        /// <returns>A new message for the SignalAConfig register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc1Pulses.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.SignalAConfig.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+    /// that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.
     /// </summary>
-    [DisplayName("TimestampedBnc1PulsesPayload")]
-    [Description("Creates a timestamped message payload that number of pulses (BNC1) [0;65535], 0-> infinite repeat.")]
-    public partial class CreateTimestampedBnc1PulsesPayload : CreateBnc1PulsesPayload
+    [DisplayName("TimestampedSignalAConfigPayload")]
+    [Description("Creates a timestamped message payload that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.")]
+    public partial class CreateTimestampedSignalAConfigPayload : CreateSignalAConfigPayload
     {
         /// <summary>
-        /// Creates a timestamped message that number of pulses (BNC1) [0;65535], 0-> infinite repeat.
+        /// Creates a timestamped message that signalAOn, SignalAOff, SignalAPulses and SignalATail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Bnc1Pulses register.</returns>
+        /// <returns>A new timestamped message for the SignalAConfig register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc1Pulses.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.SignalAConfig.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that wait time to start (milliseconds) (BNC1) [1;65535].
+    /// that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.
     /// </summary>
-    [DisplayName("Bnc1TailPayload")]
-    [Description("Creates a message payload that wait time to start (milliseconds) (BNC1) [1;65535].")]
-    public partial class CreateBnc1TailPayload
+    [DisplayName("SignalBConfigPayload")]
+    [Description("Creates a message payload that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.")]
+    public partial class CreateSignalBConfigPayload
     {
         /// <summary>
-        /// Gets or sets the value that wait time to start (milliseconds) (BNC1) [1;65535].
+        /// Gets or sets the value that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
-        [Description("The value that wait time to start (milliseconds) (BNC1) [1;65535].")]
-        public ushort Bnc1Tail { get; set; }
+        [Description("The value that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.")]
+        public ushort[] SignalBConfig { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Bnc1Tail register.
+        /// Creates a message payload for the SignalBConfig register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return Bnc1Tail;
+            return SignalBConfig;
         }
 
         /// <summary>
-        /// Creates a message that wait time to start (milliseconds) (BNC1) [1;65535].
+        /// Creates a message that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Bnc1Tail register.</returns>
+        /// <returns>A new message for the SignalBConfig register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc1Tail.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.SignalBConfig.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that wait time to start (milliseconds) (BNC1) [1;65535].
+    /// that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.
     /// </summary>
-    [DisplayName("TimestampedBnc1TailPayload")]
-    [Description("Creates a timestamped message payload that wait time to start (milliseconds) (BNC1) [1;65535].")]
-    public partial class CreateTimestampedBnc1TailPayload : CreateBnc1TailPayload
+    [DisplayName("TimestampedSignalBConfigPayload")]
+    [Description("Creates a timestamped message payload that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.")]
+    public partial class CreateTimestampedSignalBConfigPayload : CreateSignalBConfigPayload
     {
         /// <summary>
-        /// Creates a timestamped message that wait time to start (milliseconds) (BNC1) [1;65535].
+        /// Creates a timestamped message that signalBOn, SignalBOff, SignalBPulses and SignalBTail in a single message. A running train takes the new times at its next pulse.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Bnc1Tail register.</returns>
+        /// <returns>A new timestamped message for the SignalBConfig register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc1Tail.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.SignalBConfig.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time ON of BNC2 (milliseconds) [1:65535].
+    /// that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.
     /// </summary>
-    [DisplayName("Bnc2OnPayload")]
-    [Description("Creates a message payload that time ON of BNC2 (milliseconds) [1:65535].")]
-    public partial class CreateBnc2OnPayload
+    [DisplayName("ChannelsConfigPayload")]
+    [Description("Creates a message payload that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.")]
+    public partial class CreateChannelsConfigPayload
     {
         /// <summary>
-        /// Gets or sets the value that time ON of BNC2 (milliseconds) [1:65535].
+        /// Gets or sets the value that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.
         /// </summary>
-        [Description("The value that time ON of BNC2 (milliseconds) [1:65535].")]
-        public ushort Bnc2On { get; set; }
+        [Description("The value that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.")]
+        public ushort[] ChannelsConfig { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Bnc2On register.
+        /// Creates a message payload for the ChannelsConfig register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return Bnc2On;
+            return ChannelsConfig;
         }
 
         /// <summary>
-        /// Creates a message that time ON of BNC2 (milliseconds) [1:65535].
+        /// Creates a message that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Bnc2On register.</returns>
+        /// <returns>A new message for the ChannelsConfig register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc2On.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.ChannelsConfig.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time ON of BNC2 (milliseconds) [1:65535].
+    /// that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.
     /// </summary>
-    [DisplayName("TimestampedBnc2OnPayload")]
-    [Description("Creates a timestamped message payload that time ON of BNC2 (milliseconds) [1:65535].")]
-    public partial class CreateTimestampedBnc2OnPayload : CreateBnc2OnPayload
+    [DisplayName("TimestampedChannelsConfigPayload")]
+    [Description("Creates a timestamped message payload that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.")]
+    public partial class CreateTimestampedChannelsConfigPayload : CreateChannelsConfigPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time ON of BNC2 (milliseconds) [1:65535].
+        /// Creates a timestamped message that on, Off, Pulses and Tail of Bnc1, Bnc2, SignalA and SignalB, in this order, in a single message. Running trains take the new times at their next pulse.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Bnc2On register.</returns>
+        /// <returns>A new timestamped message for the ChannelsConfig register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc2On.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.ChannelsConfig.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time OFF of BNC2 (milliseconds) [1:65535].
+    /// that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).
     /// </summary>
-    [DisplayName("Bnc2OffPayload")]
-    [Description("Creates a message payload that time OFF of BNC2 (milliseconds) [1:65535].")]
-    public partial class CreateBnc2OffPayload
+    [DisplayName("TimingUpdateModePayload")]
+    [Description("Creates a message payload that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).")]
+    public partial class CreateTimingUpdateModePayload
     {
         /// <summary>
-        /// Gets or sets the value that time OFF of BNC2 (milliseconds) [1:65535].
+        /// Gets or sets the value that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).
         /// </summary>
-        [Description("The value that time OFF of BNC2 (milliseconds) [1:65535].")]
-        public ushort Bnc2Off { get; set; }
+        [Description("The value that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).")]
+        public TimingUpdateMode TimingUpdateMode { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Bnc2Off register.
+        /// Creates a message payload for the TimingUpdateMode register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public TimingUpdateMode GetPayload()
         {
-            return Bnc2Off;
+            return TimingUpdateMode;
         }
 
         /// <summary>
-        /// Creates a message that time OFF of BNC2 (milliseconds) [1:65535].
+        /// Creates a message that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Bnc2Off register.</returns>
+        /// <returns>A new message for the TimingUpdateMode register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc2Off.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.TimingUpdateMode.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time OFF of BNC2 (milliseconds) [1:65535].
+    /// that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).
     /// </summary>
-    [DisplayName("TimestampedBnc2OffPayload")]
-    [Description("Creates a timestamped message payload that time OFF of BNC2 (milliseconds) [1:65535].")]
-    public partial class CreateTimestampedBnc2OffPayload : CreateBnc2OffPayload
+    [DisplayName("TimestampedTimingUpdateModePayload")]
+    [Description("Creates a timestamped message payload that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).")]
+    public partial class CreateTimestampedTimingUpdateModePayload : CreateTimingUpdateModePayload
     {
         /// <summary>
-        /// Creates a timestamped message that time OFF of BNC2 (milliseconds) [1:65535].
+        /// Creates a timestamped message that selects whether running trains take new On and Off times at their next pulse (Immediate) or only when they are committed through TimingCommit (Staged).
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Bnc2Off register.</returns>
+        /// <returns>A new timestamped message for the TimingUpdateMode register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc2Off.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.TimingUpdateMode.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+    /// that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.
     /// </summary>
-    [DisplayName("Bnc2PulsesPayload")]
-    [Description("Creates a message payload that number of pulses (BNC2) [0;65535], 0-> infinite repeat.")]
-    public partial class CreateBnc2PulsesPayload
+    [DisplayName("TimingCommitPayload")]
+    [Description("Creates a message payload that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.")]
+    public partial class CreateTimingCommitPayload
     {
         /// <summary>
-        /// Gets or sets the value that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+        /// Gets or sets the value that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.
         /// </summary>
-        [Description("The value that number of pulses (BNC2) [0;65535], 0-> infinite repeat.")]
-        public ushort Bnc2Pulses { get; set; }
+        [Description("The value that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.")]
+        public PulseChannels TimingCommit { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Bnc2Pulses register.
+        /// Creates a message payload for the TimingCommit register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public PulseChannels GetPayload()
         {
-            return Bnc2Pulses;
+            return TimingCommit;
         }
 
         /// <summary>
-        /// Creates a message that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+        /// Creates a message that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Bnc2Pulses register.</returns>
+        /// <returns>A new message for the TimingCommit register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc2Pulses.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.TimingCommit.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+    /// that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.
     /// </summary>
-    [DisplayName("TimestampedBnc2PulsesPayload")]
-    [Description("Creates a timestamped message payload that number of pulses (BNC2) [0;65535], 0-> infinite repeat.")]
-    public partial class CreateTimestampedBnc2PulsesPayload : CreateBnc2PulsesPayload
+    [DisplayName("TimestampedTimingCommitPayload")]
+    [Description("Creates a timestamped message payload that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.")]
+    public partial class CreateTimestampedTimingCommitPayload : CreateTimingCommitPayload
     {
         /// <summary>
-        /// Creates a timestamped message that number of pulses (BNC2) [0;65535], 0-> infinite repeat.
+        /// Creates a timestamped message that applies the times written to the selected channels since the last commit. All of them are handed over at once, each running train switches to the new On and Off times at its next pulse and Pulses and Tail are used from the next start.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Bnc2Pulses register.</returns>
+        /// <returns>A new timestamped message for the TimingCommit register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc2Pulses.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.TimingCommit.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that wait time to start (milliseconds) (BNC2) [1;65535].
+    /// that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
     /// </summary>
-    [DisplayName("Bnc2TailPayload")]
-    [Description("Creates a message payload that wait time to start (milliseconds) (BNC2) [1;65535].")]
-    public partial class CreateBnc2TailPayload
+    [DisplayName("SpadSwitchDebouncePayload")]
+    [Description("Creates a message payload that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.")]
+    public partial class CreateSpadSwitchDebouncePayload
     {
         /// <summary>
-        /// Gets or sets the value that wait time to start (milliseconds) (BNC2) [1;65535].
+        /// Gets or sets the value that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
         /// </summary>
-        [Description("The value that wait time to start (milliseconds) (BNC2) [1;65535].")]
-        public ushort Bnc2Tail { get; set; }
+        [Description("The value that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.")]
+        public byte SpadSwitchDebounce { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Bnc2Tail register.
+        /// Creates a message payload for the SpadSwitchDebounce register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte GetPayload()
         {
-            return Bnc2Tail;
+            return SpadSwitchDebounce;
         }
 
         /// <summary>
-        /// Creates a message that wait time to start (milliseconds) (BNC2) [1;65535].
+        /// Creates a message that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Bnc2Tail register.</returns>
+        /// <returns>A new message for the SpadSwitchDebounce register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc2Tail.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.SpadSwitchDebounce.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that wait time to start (milliseconds) (BNC2) [1;65535].
+    /// that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
     /// </summary>
-    [DisplayName("TimestampedBnc2TailPayload")]
-    [Description("Creates a timestamped message payload that wait time to start (milliseconds) (BNC2) [1;65535].")]
-    public partial class CreateTimestampedBnc2TailPayload : CreateBnc2TailPayload
+    [DisplayName("TimestampedSpadSwitchDebouncePayload")]
+    [Description("Creates a timestamped message payload that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.")]
+    public partial class CreateTimestampedSpadSwitchDebouncePayload : CreateSpadSwitchDebouncePayload
     {
         /// <summary>
-        /// Creates a timestamped message that wait time to start (milliseconds) (BNC2) [1;65535].
+        /// Creates a timestamped message that debounce window of the SPAD switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Bnc2Tail register.</returns>
+        /// <returns>A new timestamped message for the SpadSwitchDebounce register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.Bnc2Tail.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.SpadSwitchDebounce.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time ON of SignalA (milliseconds) [1:65535].
+    /// that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
     /// </summary>
-    [DisplayName("SignalAOnPayload")]
-    [Description("Creates a message payload that time ON of SignalA (milliseconds) [1:65535].")]
-    public partial class CreateSignalAOnPayload
+    [DisplayName("LaserStateDebouncePayload")]
+    [Description("Creates a message payload that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.")]
+    public partial class CreateLaserStateDebouncePayload
     {
         /// <summary>
-        /// Gets or sets the value that time ON of SignalA (milliseconds) [1:65535].
+        /// Gets or sets the value that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
         /// </summary>
-        [Description("The value that time ON of SignalA (milliseconds) [1:65535].")]
-        public ushort SignalAOn { get; set; }
+        [Description("The value that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.")]
+        public byte LaserStateDebounce { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalAOn register.
+        /// Creates a message payload for the LaserStateDebounce register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte GetPayload()
         {
-            return SignalAOn;
+            return LaserStateDebounce;
         }
 
         /// <summary>
-        /// Creates a message that time ON of SignalA (milliseconds) [1:65535].
+        /// Creates a message that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalAOn register.</returns>
+        /// <returns>A new message for the LaserStateDebounce register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalAOn.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.LaserStateDebounce.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time ON of SignalA (milliseconds) [1:65535].
+    /// that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
     /// </summary>
-    [DisplayName("TimestampedSignalAOnPayload")]
-    [Description("Creates a timestamped message payload that time ON of SignalA (milliseconds) [1:65535].")]
-    public partial class CreateTimestampedSignalAOnPayload : CreateSignalAOnPayload
+    [DisplayName("TimestampedLaserStateDebouncePayload")]
+    [Description("Creates a timestamped message payload that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.")]
+    public partial class CreateTimestampedLaserStateDebouncePayload : CreateLaserStateDebouncePayload
     {
         /// <summary>
-        /// Creates a timestamped message that time ON of SignalA (milliseconds) [1:65535].
+        /// Creates a timestamped message that debounce window of the key switch input (milliseconds) [0;255]. The level is sampled when the window closes and the event carries the time of the first edge. 0 -> disabled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalAOn register.</returns>
+        /// <returns>A new timestamped message for the LaserStateDebounce register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalAOn.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.LaserStateDebounce.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time OFF of SignalA (milliseconds) [1:65535].
+    /// that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.
     /// </summary>
-    [DisplayName("SignalAOffPayload")]
-    [Description("Creates a message payload that time OFF of SignalA (milliseconds) [1:65535].")]
-    public partial class CreateSignalAOffPayload
+    [DisplayName("InterlockLatencyPayload")]
+    [Description("Creates a message payload that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.")]
+    public partial class CreateInterlockLatencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that time OFF of SignalA (milliseconds) [1:65535].
+        /// Gets or sets the value that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.
         /// </summary>
-        [Description("The value that time OFF of SignalA (milliseconds) [1:65535].")]
-        public ushort SignalAOff { get; set; }
+        [Description("The value that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.")]
+        public ushort InterlockLatency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalAOff register.
+        /// Creates a message payload for the InterlockLatency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return SignalAOff;
+            return InterlockLatency;
         }
 
         /// <summary>
-        /// Creates a message that time OFF of SignalA (milliseconds) [1:65535].
+        /// Creates a message that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalAOff register.</returns>
+        /// <returns>A new message for the InterlockLatency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalAOff.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.InterlockLatency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time OFF of SignalA (milliseconds) [1:65535].
+    /// that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.
     /// </summary>
-    [DisplayName("TimestampedSignalAOffPayload")]
-    [Description("Creates a timestamped message payload that time OFF of SignalA (milliseconds) [1:65535].")]
-    public partial class CreateTimestampedSignalAOffPayload : CreateSignalAOffPayload
+    [DisplayName("TimestampedInterlockLatencyPayload")]
+    [Description("Creates a timestamped message payload that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.")]
+    public partial class CreateTimestampedInterlockLatencyPayload : CreateInterlockLatencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time OFF of SignalA (milliseconds) [1:65535].
+        /// Creates a timestamped message that time from the last key switch off edge to the laser outputs going low (microseconds), measured by the firmware.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalAOff register.</returns>
+        /// <returns>A new timestamped message for the InterlockLatency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalAOff.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.InterlockLatency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+    /// that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.
     /// </summary>
-    [DisplayName("SignalAPulsesPayload")]
-    [Description("Creates a message payload that number of pulses (SignalA) [0;65535], 0-> infinite repeat.")]
-    public partial class CreateSignalAPulsesPayload
+    [DisplayName("DiagnosticsPayload")]
+    [Description("Creates a message payload that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.")]
+    public partial class CreateDiagnosticsPayload
     {
         /// <summary>
-        /// Gets or sets the value that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+        /// Gets or sets the value that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.
         /// </summary>
-        [Description("The value that number of pulses (SignalA) [0;65535], 0-> infinite repeat.")]
-        public ushort SignalAPulses { get; set; }
+        [Description("The value that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.")]
+        public ushort[] Diagnostics { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalAPulses register.
+        /// Creates a message payload for the Diagnostics register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return SignalAPulses;
+            return Diagnostics;
         }
 
         /// <summary>
-        /// Creates a message that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+        /// Creates a message that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalAPulses register.</returns>
+        /// <returns>A new message for the Diagnostics register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalAPulses.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.Diagnostics.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+    /// that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.
     /// </summary>
-    [DisplayName("TimestampedSignalAPulsesPayload")]
-    [Description("Creates a timestamped message payload that number of pulses (SignalA) [0;65535], 0-> infinite repeat.")]
-    public partial class CreateTimestampedSignalAPulsesPayload : CreateSignalAPulsesPayload
+    [DisplayName("TimestampedDiagnosticsPayload")]
+    [Description("Creates a timestamped message payload that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.")]
+    public partial class CreateTimestampedDiagnosticsPayload : CreateDiagnosticsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that number of pulses (SignalA) [0;65535], 0-> infinite repeat.
+        /// Creates a timestamped message that minimum, maximum and running mean execution time (CPU cycles at 32 MHz) of core_callback_t_500us, core_callback_t_1ms, the pulse engine interrupt, the digipot write and the register writes, in this order.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalAPulses register.</returns>
+        /// <returns>A new timestamped message for the Diagnostics register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalAPulses.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.Diagnostics.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that wait time to start (milliseconds) (SignalA) [1;65535].
+    /// that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.
     /// </summary>
-    [DisplayName("SignalATailPayload")]
-    [Description("Creates a message payload that wait time to start (milliseconds) (SignalA) [1;65535].")]
-    public partial class CreateSignalATailPayload
+    [DisplayName("DiagnosticsResetPayload")]
+    [Description("Creates a message payload that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.")]
+    public partial class CreateDiagnosticsResetPayload
     {
         /// <summary>
-        /// Gets or sets the value that wait time to start (milliseconds) (SignalA) [1;65535].
+        /// Gets or sets the value that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.
         /// </summary>
-        [Description("The value that wait time to start (milliseconds) (SignalA) [1;65535].")]
-        public ushort SignalATail { get; set; }
+        [Description("The value that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.")]
+        public byte DiagnosticsReset { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalATail register.
+        /// Creates a message payload for the DiagnosticsReset register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte GetPayload()
         {
-            return SignalATail;
+            return DiagnosticsReset;
         }
 
         /// <summary>
-        /// Creates a message that wait time to start (milliseconds) (SignalA) [1;65535].
+        /// Creates a message that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalATail register.</returns>
+        /// <returns>A new message for the DiagnosticsReset register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalATail.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.DiagnosticsReset.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that wait time to start (milliseconds) (SignalA) [1;65535].
+    /// that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.
     /// </summary>
-    [DisplayName("TimestampedSignalATailPayload")]
-    [Description("Creates a timestamped message payload that wait time to start (milliseconds) (SignalA) [1;65535].")]
-    public partial class CreateTimestampedSignalATailPayload : CreateSignalATailPayload
+    [DisplayName("TimestampedDiagnosticsResetPayload")]
+    [Description("Creates a timestamped message payload that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.")]
+    public partial class CreateTimestampedDiagnosticsResetPayload : CreateDiagnosticsResetPayload
     {
         /// <summary>
-        /// Creates a timestamped message that wait time to start (milliseconds) (SignalA) [1;65535].
+        /// Creates a timestamped message that bit 0 clears the statistics in Diagnostics, bit 1 clears LatencyHistogram and bit 2 clears UartTxStats.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalATail register.</returns>
+        /// <returns>A new timestamped message for the DiagnosticsReset register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalATail.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.DiagnosticsReset.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time ON of SignalB (milliseconds) [1:65535].
+    /// that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.
     /// </summary>
-    [DisplayName("SignalBOnPayload")]
-    [Description("Creates a message payload that time ON of SignalB (milliseconds) [1:65535].")]
-    public partial class CreateSignalBOnPayload
+    [DisplayName("LatencyHistogramPayload")]
+    [Description("Creates a message payload that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.")]
+    public partial class CreateLatencyHistogramPayload
     {
         /// <summary>
-        /// Gets or sets the value that time ON of SignalB (milliseconds) [1:65535].
+        /// Gets or sets the value that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.
         /// </summary>
-        [Description("The value that time ON of SignalB (milliseconds) [1:65535].")]
-        public ushort SignalBOn { get; set; }
+        [Description("The value that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.")]
+        public ushort[] LatencyHistogram { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalBOn register.
+        /// Creates a message payload for the LatencyHistogram register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return SignalBOn;
+            return LatencyHistogram;
         }
 
         /// <summary>
-        /// Creates a message that time ON of SignalB (milliseconds) [1:65535].
+        /// Creates a message that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalBOn register.</returns>
+        /// <returns>A new message for the LatencyHistogram register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalBOn.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.LatencyHistogram.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time ON of SignalB (milliseconds) [1:65535].
+    /// that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.
     /// </summary>
-    [DisplayName("TimestampedSignalBOnPayload")]
-    [Description("Creates a timestamped message payload that time ON of SignalB (milliseconds) [1:65535].")]
-    public partial class CreateTimestampedSignalBOnPayload : CreateSignalBOnPayload
+    [DisplayName("TimestampedLatencyHistogramPayload")]
+    [Description("Creates a timestamped message payload that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.")]
+    public partial class CreateTimestampedLatencyHistogramPayload : CreateLatencyHistogramPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time ON of SignalB (milliseconds) [1:65535].
+        /// Creates a timestamped message that histogram of the time from the arrival of a register write to its physical effect (digipot latch for LaserIntensity and LaserPower, output change for the Output registers, start time of the started trains, before any Tail, for BncsState, SignalState and ChannelsState). Bin 0 counts latencies under 1 us and bin n counts [2^(n-1);2^n[ us. Counts saturate at 65535.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalBOn register.</returns>
+        /// <returns>A new timestamped message for the LatencyHistogram register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalBOn.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.LatencyHistogram.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time OFF of SignalB (milliseconds) [1:65535].
+    /// that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.
     /// </summary>
-    [DisplayName("SignalBOffPayload")]
-    [Description("Creates a message payload that time OFF of SignalB (milliseconds) [1:65535].")]
-    public partial class CreateSignalBOffPayload
+    [DisplayName("UartTxStatsPayload")]
+    [Description("Creates a message payload that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.")]
+    public partial class CreateUartTxStatsPayload
     {
         /// <summary>
-        /// Gets or sets the value that time OFF of SignalB (milliseconds) [1:65535].
+        /// Gets or sets the value that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.
         /// </summary>
-        [Description("The value that time OFF of SignalB (milliseconds) [1:65535].")]
-        public ushort SignalBOff { get; set; }
+        [Description("The value that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.")]
+        public uint[] UartTxStats { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalBOff register.
+        /// Creates a message payload for the UartTxStats register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public uint[] GetPayload()
         {
-            return SignalBOff;
+            return UartTxStats;
         }
 
         /// <summary>
-        /// Creates a message that time OFF of SignalB (milliseconds) [1:65535].
+        /// Creates a message that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalBOff register.</returns>
+        /// <returns>A new message for the UartTxStats register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalBOff.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.UartTxStats.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time OFF of SignalB (milliseconds) [1:65535].
+    /// that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.
     /// </summary>
-    [DisplayName("TimestampedSignalBOffPayload")]
-    [Description("Creates a timestamped message payload that time OFF of SignalB (milliseconds) [1:65535].")]
-    public partial class CreateTimestampedSignalBOffPayload : CreateSignalBOffPayload
+    [DisplayName("TimestampedUartTxStatsPayload")]
+    [Description("Creates a timestamped message payload that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.")]
+    public partial class CreateTimestampedUartTxStatsPayload : CreateUartTxStatsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time OFF of SignalB (milliseconds) [1:65535].
+        /// Creates a timestamped message that current fill and high-water mark of the 5120 bytes UART TX buffer (bytes), number of events dropped because they did not fit, and total time the host held CTS (microseconds). Bit 2 of DiagnosticsReset clears them.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalBOff register.</returns>
+        /// <returns>A new timestamped message for the UartTxStats register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalBOff.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.UartTxStats.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+    /// that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.
     /// </summary>
-    [DisplayName("SignalBPulsesPayload")]
-    [Description("Creates a message payload that number of pulses (SignalB) [0;65535], 0-> infinite repeat.")]
-    public partial class CreateSignalBPulsesPayload
+    [DisplayName("EdgeEventsPayload")]
+    [Description("Creates a message payload that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.")]
+    public partial class CreateEdgeEventsPayload
     {
         /// <summary>
-        /// Gets or sets the value that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+        /// Gets or sets the value that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.
         /// </summary>
-        [Description("The value that number of pulses (SignalB) [0;65535], 0-> infinite repeat.")]
-        public ushort SignalBPulses { get; set; }
+        [Description("The value that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.")]
+        public uint[] EdgeEvents { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalBPulses register.
+        /// Creates a message payload for the EdgeEvents register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public uint[] GetPayload()
         {
-            return SignalBPulses;
+            return EdgeEvents;
         }
 
         /// <summary>
-        /// Creates a message that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+        /// Creates a message that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalBPulses register.</returns>
+        /// <returns>A new message for the EdgeEvents register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalBPulses.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.EdgeEvents.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+    /// that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.
     /// </summary>
-    [DisplayName("TimestampedSignalBPulsesPayload")]
-    [Description("Creates a timestamped message payload that number of pulses (SignalB) [0;65535], 0-> infinite repeat.")]
-    public partial class CreateTimestampedSignalBPulsesPayload : CreateSignalBPulsesPayload
+    [DisplayName("TimestampedEdgeEventsPayload")]
+    [Description("Creates a timestamped message payload that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.")]
+    public partial class CreateTimestampedEdgeEventsPayload : CreateEdgeEventsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that number of pulses (SignalB) [0;65535], 0-> infinite repeat.
+        /// Creates a timestamped message that batch of up to 16 edges of the channels in EdgeEventsChannels. Each entry holds the level after the edge (bit 31), the channel index (bits 30 to 28) and the time of the edge after the event timestamp (microseconds, bits 27 to 0). Unused entries are 0xFFFFFFFF.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalBPulses register.</returns>
+        /// <returns>A new timestamped message for the EdgeEvents register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalBPulses.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.EdgeEvents.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that wait time to start (milliseconds) (SignalB) [1;65535].
+    /// that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.
     /// </summary>
-    [DisplayName("SignalBTailPayload")]
-    [Description("Creates a message payload that wait time to start (milliseconds) (SignalB) [1;65535].")]
-    public partial class CreateSignalBTailPayload
+    [DisplayName("EdgeEventsChannelsPayload")]
+    [Description("Creates a message payload that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.")]
+    public partial class CreateEdgeEventsChannelsPayload
     {
         /// <summary>
-        /// Gets or sets the value that wait time to start (milliseconds) (SignalB) [1;65535].
+        /// Gets or sets the value that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.
         /// </summary>
-        [Description("The value that wait time to start (milliseconds) (SignalB) [1;65535].")]
-        public ushort SignalBTail { get; set; }
+        [Description("The value that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.")]
+        public PulseChannels EdgeEventsChannels { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SignalBTail register.
+        /// Creates a message payload for the EdgeEventsChannels register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public PulseChannels GetPayload()
         {
-            return SignalBTail;
+            return EdgeEventsChannels;
         }
 
         /// <summary>
-        /// Creates a message that wait time to start (milliseconds) (SignalB) [1;65535].
+        /// Creates a message that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SignalBTail register.</returns>
+        /// <returns>A new message for the EdgeEventsChannels register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalBTail.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.EdgeEventsChannels.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that wait time to start (milliseconds) (SignalB) [1;65535].
+    /// that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.
     /// </summary>
-    [DisplayName("TimestampedSignalBTailPayload")]
-    [Description("Creates a timestamped message payload that wait time to start (milliseconds) (SignalB) [1;65535].")]
-    public partial class CreateTimestampedSignalBTailPayload : CreateSignalBTailPayload
+    [DisplayName("TimestampedEdgeEventsChannelsPayload")]
+    [Description("Creates a timestamped message payload that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.")]
+    public partial class CreateTimestampedEdgeEventsChannelsPayload : CreateEdgeEventsChannelsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that wait time to start (milliseconds) (SignalB) [1;65535].
+        /// Creates a timestamped message that channels whose rising and falling edges are reported through EdgeEvents. 0 disables the edge events.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SignalBTail register.</returns>
+        /// <returns>A new timestamped message for the EdgeEventsChannels register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.SignalBTail.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.EdgeEventsChannels.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that specifies the active events in the device.
+    /// that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.
     /// </summary>
-    [DisplayName("EventEnablePayload")]
-    [Description("Creates a message payload that specifies the active events in the device.")]
-    public partial class CreateEventEnablePayload
+    [DisplayName("EdgeEventsLatencyPayload")]
+    [Description("Creates a message payload that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.")]
+    public partial class CreateEdgeEventsLatencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that specifies the active events in the device.
+        /// Gets or sets the value that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.
         /// </summary>
-        [Description("The value that specifies the active events in the device.")]
-        public LaserDriverControllerEvents EventEnable { get; set; }
+        [Description("The value that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.")]
+        public byte EdgeEventsLatency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EventEnable register.
+        /// Creates a message payload for the EdgeEventsLatency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LaserDriverControllerEvents GetPayload()
+        public byte GetPayload()
         {
-            return EventEnable;
+            return EdgeEventsLatency;
         }
 
         /// <summary>
-        /// Creates a message that specifies the active events in the device.
+        /// Creates a message that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EventEnable register.</returns>
+        /// <returns>A new message for the EdgeEventsLatency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LaserDriverController.EventEnable.FromPayload(messageType, GetPayload());
+            return Harp.LaserDriverController.EdgeEventsLatency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that specifies the active events in the device.
+    /// that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.
     /// </summary>
-    [DisplayName("TimestampedEventEnablePayload")]
-    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
-    public partial class CreateTimestampedEventEnablePayload : CreateEventEnablePayload
+    [DisplayName("TimestampedEdgeEventsLatencyPayload")]
+    [Description("Creates a timestamped message payload that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.")]
+    public partial class CreateTimestampedEdgeEventsLatencyPayload : CreateEdgeEventsLatencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that specifies the active events in the device.
+        /// Creates a timestamped message that longest time an edge waits before its batch is sent in EdgeEvents (milliseconds) [1;255]. A batch is also sent as soon as it holds 16 edges.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EventEnable register.</returns>
+        /// <returns>A new timestamped message for the EdgeEventsLatency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LaserDriverController.EventEnable.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LaserDriverController.EdgeEventsLatency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
@@ -4809,7 +13029,22 @@ namespace Harp.LaserDriverController
     {
         None = 0x0,
         EventSpadSwitch = 0x1,
-        EventLaserState = 0x2
+        EventLaserState = 0x2,
+        EventBncsState = 0x4,
+        EventSignalState = 0x8
+    }
+
+    /// <summary>
+    /// Specifies the pulse channels
+    /// </summary>
+    [Flags]
+    public enum PulseChannels : byte
+    {
+        None = 0x0,
+        Bnc1 = 0x1,
+        Bnc2 = 0x2,
+        SignalA = 0x4,
+        SignalB = 0x8
     }
 
     /// <summary>
@@ -4823,4 +13058,24 @@ namespace Harp.LaserDriverController
         F3 = 4,
         CW = 8
     }
+
+    /// <summary>
+    /// Selects the edge of the trigger input
+    /// </summary>
+    public enum TriggerMode : byte
+    {
+        Disabled = 0,
+        Rising = 1,
+        Falling = 2,
+        Both = 3
+    }
+
+    /// <summary>
+    /// Selects when running trains take new times
+    /// </summary>
+    public enum TimingUpdateMode : byte
+    {
+        Immediate = 0,
+        Staged = 1
+    }
 }